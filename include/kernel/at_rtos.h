@@ -42,8 +42,26 @@ typedef struct os_id os_msgq_id_t;
 typedef struct os_id os_pool_id_t;
 typedef struct os_id os_publish_id_t;
 typedef struct os_id os_subscribe_id_t;
+typedef struct os_id os_rwlock_id_t;
+typedef struct os_id os_cond_id_t;
+typedef struct os_id os_barrier_id_t;
+typedef struct os_id os_latch_id_t;
+typedef struct os_id os_stream_id_t;
 
 typedef struct evt_val os_evt_val_t;
+typedef struct evt_wide_val os_evt_wide_val_t;
+typedef struct timer_statistics os_timer_statistics_t;
+typedef struct mutex_statistics os_mutex_statistics_t;
+typedef struct fpu_statistics os_fpu_statistics_t;
+typedef struct coroutine_context os_coroutine_t;
+typedef struct coroutine_group os_coroutine_group_t;
+typedef struct rtc_task os_rtc_task_t;
+typedef struct rtc_level os_rtc_level_t;
+
+#define OS_EVT_WORD_NUMBER (EVENT_VALUE_WORD_NUMBER)
+
+#define OS_MSGQ_PRIORITY_NUMBER                (QUEUE_PRIORITY_NUMBER)
+#define OS_MSGQ_PRIORITY_BUFFER_SIZE(len, num) (QUEUE_PRIORITY_SLOT_SIZE(len) * (num))
 
 #define OS_PRIORITY_INVALID             (OS_PRIOTITY_INVALID_LEVEL)
 #define OS_PRIORITY_APPLICATION_HIGHEST (OS_PRIORITY_APPLICATION_HIGHEST_LEVEL)
@@ -62,6 +80,78 @@ typedef struct evt_val os_evt_val_t;
 #define OS_POOL_INIT(id_name, pMemAddr, len, num)               INIT_OS_POOL_DEFINE(id_name, pMemAddr, len, num)
 #define OS_SUBSCRIBE_INIT(id_name, pDataAddr, size)             INIT_OS_SUBSCRIBE_DEFINE(id_name, pDataAddr, size)
 #define OS_PUBLISH_INIT(id_name, pDataAddr, size)               INIT_OS_PUBLISH_DEFINE(id_name, pDataAddr, size)
+#define OS_RWLOCK_INIT(id_name)                                 INIT_OS_RWLOCK_DEFINE(id_name)
+#define OS_COND_INIT(id_name)                                   INIT_OS_COND_DEFINE(id_name)
+#define OS_BARRIER_INIT(id_name, parties)                       INIT_OS_BARRIER_DEFINE(id_name, parties)
+#define OS_LATCH_INIT(id_name, count)                           INIT_OS_LATCH_DEFINE(id_name, count)
+#define OS_STREAM_INIT(id_name, pBufAddr, size, trigger)        INIT_OS_STREAM_DEFINE(id_name, pBufAddr, size, trigger, false)
+#define OS_MSGBUF_INIT(id_name, pBufAddr, size)                 INIT_OS_STREAM_DEFINE(id_name, pBufAddr, size, 1u, true)
+
+/* The coroutine entry function returns one of the states, the OS_CO_END returns the OS_CO_EXITED */
+#define OS_CO_WAITING (0u)
+#define OS_CO_YIELDED (1u)
+#define OS_CO_EXITED  (2u)
+
+#define OS_COROUTINE_INIT(id_name, pEntryFn, pArgument)                                                                                    \
+    os_coroutine_t id_name = {.pNext = NULL, .pEntryFunc = pEntryFn, .pArg = (void *)(pArgument), .pName = #id_name, .lc = 0u}
+#define OS_COROUTINE_GROUP_INIT(id_name) os_coroutine_group_t id_name = {.pHead = NULL, .pTask = NULL, .notified = false}
+
+/**
+ * The coroutine body is put between the OS_CO_BEGIN and OS_CO_END, it resumes at the last wait point by the continuation and it has no
+ * own stack. So the local variables don't survive the wait points, keep them in the pArg, and don't put a wait point in a switch block.
+ */
+#define OS_CO_BEGIN(pCo)                                                                                                                   \
+    switch ((pCo)->lc) {                                                                                                                   \
+    case 0u:
+#define OS_CO_END(pCo)                                                                                                                     \
+    }                                                                                                                                      \
+    (pCo)->lc = 0u;                                                                                                                        \
+    return OS_CO_EXITED
+#define OS_CO_WAIT_UNTIL(pCo, condition)                                                                                                   \
+    do {                                                                                                                                   \
+        (pCo)->lc = (u16_t)__LINE__;                                                                                                       \
+    case __LINE__:                                                                                                                         \
+        if (!(condition)) {                                                                                                                \
+            return OS_CO_WAITING;                                                                                                          \
+        }                                                                                                                                  \
+    } while (0)
+#define OS_CO_YIELD(pCo)                                                                                                                   \
+    do {                                                                                                                                   \
+        (pCo)->lc = (u16_t)__LINE__;                                                                                                       \
+        return OS_CO_YIELDED;                                                                                                              \
+    case __LINE__:;                                                                                                                        \
+    } while (0)
+#define OS_CO_SLEEP(pCo, ms)                                                                                                               \
+    do {                                                                                                                                   \
+        os_coroutine_sleep_set((pCo), (ms));                                                                                               \
+        OS_CO_WAIT_UNTIL((pCo), !(pCo)->sleep);                                                                                            \
+    } while (0)
+#define OS_CO_SEM_TAKE(pCo, id)              OS_CO_WAIT_UNTIL((pCo), (os_coroutine_sem_take((pCo), (id)) == OS_PC_OK))
+#define OS_CO_EVT_WAIT(pCo, id, pEvtData, mask)                                                                                            \
+    OS_CO_WAIT_UNTIL((pCo), (os_coroutine_evt_wait((pCo), (id), (pEvtData), (mask)) == OS_PC_OK))
+#define OS_CO_MSGQ_GET(pCo, id, pBuf, size)                                                                                                \
+    OS_CO_WAIT_UNTIL((pCo), (os_coroutine_msgq_get((pCo), (id), (pBuf), (size)) == OS_PC_OK))
+
+/**
+ * The run-to-completion tasks of one level share the stack of the level thread, the handler is called once for each posted event and it
+ * must return without blocking. The higher priority level thread preempts the lower one as the ordinary threads do.
+ */
+#define OS_RTC_TASK_INIT(id_name, pHandlerFn, pArgument, event_depth)                                                                      \
+    static u32_t id_name##_events[event_depth];                                                                                            \
+    os_rtc_task_t id_name = {.pNext = NULL,                                                                                                \
+                             .pLevel = NULL,                                                                                               \
+                             .pHandlerFunc = pHandlerFn,                                                                                   \
+                             .pArg = (void *)(pArgument),                                                                                  \
+                             .pName = #id_name,                                                                                            \
+                             .pEvents = id_name##_events,                                                                                  \
+                             .depth = (event_depth)}
+#define OS_RTC_LEVEL_INIT(id_name, priority, stack_size)                                                                                   \
+    os_rtc_level_t id_name = {.pHead = NULL, .pTask = NULL, .notified = false};                                                            \
+    static void id_name##_entry(void)                                                                                                      \
+    {                                                                                                                                      \
+        os_rtc_level_run(&id_name);                                                                                                        \
+    }                                                                                                                                      \
+    INIT_OS_THREAD_DEFINE(id_name##_th, priority, stack_size, id_name##_entry)
 
 /**
  * @brief Initialize a thread, and put it to pending list that are ready to run.
@@ -156,6 +246,208 @@ static inline i32p_t os_thread_delete(os_thread_id_t id)
     return (i32p_t)_impl_thread_delete(id.u32_val);
 }
 
+/**
+ * @brief Put the thread into the earliest deadline first class, the deadline threads run ahead of the fixed priority threads in the same
+ * priority and they are ordered by the absolute deadline.
+ *
+ * @param id The thread unique id.
+ * @param period_ms The job release period, the value 0 puts the thread back to the fixed priority class.
+ * @param deadline_ms The relative deadline of each job, the value 0 takes the period.
+ *
+ * @return The result of the operation, it fails if the THREAD_DEADLINE_ENABLED is disabled.
+ */
+static inline i32p_t os_thread_deadline_set(os_thread_id_t id, u32_t period_ms, u32_t deadline_ms)
+{
+    extern i32p_t _impl_thread_deadline_set(u32_t ctx, u32_t period_ms, u32_t deadline_ms);
+
+    return (i32p_t)_impl_thread_deadline_set(id.u32_val, period_ms, deadline_ms);
+}
+
+/**
+ * @brief Complete the current job of the deadline thread and sleep until the next job is released.
+ *
+ * @return The result of the operation, it fails if the THREAD_DEADLINE_ENABLED is disabled.
+ */
+static inline i32p_t os_thread_deadline_wait(void)
+{
+    extern i32p_t _impl_thread_deadline_wait(void);
+
+    return (i32p_t)_impl_thread_deadline_wait();
+}
+
+/**
+ * @brief Limit the thread execution time by a budget that's replenished on each period, the thread that exhausts its budget is demoted
+ * to the lowest application priority until the next replenishment.
+ *
+ * @param id The thread unique id.
+ * @param budget_us The execution budget in each period, the value 0 removes the limitation.
+ * @param period_ms The replenishment period.
+ *
+ * @return The result of the operation, it fails if the THREAD_BUDGET_ENABLED is disabled.
+ */
+static inline i32p_t os_thread_budget_set(os_thread_id_t id, u32_t budget_us, u32_t period_ms)
+{
+    extern i32p_t _impl_thread_budget_set(u32_t ctx, u32_t budget_us, u32_t period_ms);
+
+    return (i32p_t)_impl_thread_budget_set(id.u32_val, budget_us, period_ms);
+}
+
+/**
+ * @brief Add a coroutine into the group, it starts from the beginning at the next group pass.
+ *
+ * @param pGroup The pointer of the coroutine group.
+ * @param pCo The pointer of the coroutine.
+ *
+ * @return The result of the operation.
+ */
+static inline i32p_t os_coroutine_add(os_coroutine_group_t *pGroup, os_coroutine_t *pCo)
+{
+    extern i32p_t _impl_coroutine_add(struct coroutine_group * pGroup, struct coroutine_context * pCo);
+
+    return (i32p_t)_impl_coroutine_add(pGroup, pCo);
+}
+
+/**
+ * @brief Run the coroutines of the group in the calling thread, it never returns. The thread waits in the kernel when no coroutine can
+ * make progress, until the nearest coroutine wake time, the post of the kernel object that a coroutine waits, or the os_coroutine_notify.
+ * The condition of the OS_CO_WAIT_UNTIL is polled in the COROUTINE_POLL_INTERVAL_MS.
+ *
+ * @param pGroup The pointer of the coroutine group.
+ *
+ * @return The result of the operation if the group can't be run.
+ */
+static inline i32p_t os_coroutine_group_run(os_coroutine_group_t *pGroup)
+{
+    extern i32p_t _impl_coroutine_group_run(struct coroutine_group * pGroup);
+
+    return (i32p_t)_impl_coroutine_group_run(pGroup);
+}
+
+/**
+ * @brief Wake the group thread up to run the coroutines at once, the producer calls it after it gave the object that a coroutine waits.
+ *
+ * @param pGroup The pointer of the coroutine group.
+ *
+ * @return The result of the operation.
+ */
+static inline i32p_t os_coroutine_notify(os_coroutine_group_t *pGroup)
+{
+    extern i32p_t _impl_coroutine_notify(struct coroutine_group * pGroup);
+
+    return (i32p_t)_impl_coroutine_notify(pGroup);
+}
+
+/**
+ * @brief Set the coroutine wake time, it's used by the OS_CO_SLEEP.
+ *
+ * @param pCo The pointer of the coroutine.
+ * @param ms The sleep time.
+ */
+static inline void os_coroutine_sleep_set(os_coroutine_t *pCo, u32_t ms)
+{
+    extern void _impl_coroutine_sleep_set(struct coroutine_context * pCo, u32_t ms);
+
+    _impl_coroutine_sleep_set(pCo, ms);
+}
+
+/**
+ * @brief Take the semaphore in the coroutine without waiting, it's used by the OS_CO_SEM_TAKE. The coroutine group is woken up by the
+ * next give when it's not available.
+ *
+ * @param pCo The pointer of the coroutine.
+ * @param id The semaphore unique id.
+ *
+ * @return The result of the operation.
+ */
+static inline i32p_t os_coroutine_sem_take(os_coroutine_t *pCo, os_sem_id_t id)
+{
+    extern i32p_t _impl_semaphore_co_take(u32_t ctx, struct coroutine_context * pCo);
+
+    return (i32p_t)_impl_semaphore_co_take(id.u32_val, pCo);
+}
+
+/**
+ * @brief Wait a trigger event in the coroutine without waiting, it's used by the OS_CO_EVT_WAIT. The coroutine group is woken up by the
+ * next set that triggers the event.
+ *
+ * @param pCo The pointer of the coroutine.
+ * @param id The event unique id.
+ * @param pEvtData The pointer of event value.
+ * @param listen_mask Current coroutine listen which bits in the event.
+ *
+ * @return The result of the operation.
+ */
+static inline i32p_t os_coroutine_evt_wait(os_coroutine_t *pCo, os_evt_id_t id, os_evt_val_t *pEvtData, u32_t listen_mask)
+{
+    extern i32p_t _impl_event_co_wait(u32_t ctx, struct evt_val * pEvtData, u32_t listen_mask, struct coroutine_context * pCo);
+
+    return (i32p_t)_impl_event_co_wait(id.u32_val, pEvtData, listen_mask, pCo);
+}
+
+/**
+ * @brief Receive a message in the coroutine without waiting, it's used by the OS_CO_MSGQ_GET. The coroutine group is woken up by the
+ * next send when the queue is empty.
+ *
+ * @param pCo The pointer of the coroutine.
+ * @param id The queue unique id.
+ * @param pUserBuffer The pointer of the message buffer address.
+ * @param size The message buffer size.
+ *
+ * @return The result of the operation.
+ */
+static inline i32p_t os_coroutine_msgq_get(os_coroutine_t *pCo, os_msgq_id_t id, const u8_t *pUserBuffer, u16_t size)
+{
+    extern i32p_t _impl_queue_co_receive(u32_t ctx, const u8_t *pUserBuffer, u16_t bufferSize, b_t isFromBack,
+                                         struct coroutine_context *pCo);
+
+    return (i32p_t)_impl_queue_co_receive(id.u32_val, pUserBuffer, size, false, pCo);
+}
+
+/**
+ * @brief Add a run-to-completion task into the level, the task can't be moved to another level.
+ *
+ * @param pLevel The pointer of the run-to-completion level.
+ * @param pTask The pointer of the run-to-completion task.
+ *
+ * @return The result of the operation.
+ */
+static inline i32p_t os_rtc_task_add(os_rtc_level_t *pLevel, os_rtc_task_t *pTask)
+{
+    extern i32p_t _impl_rtc_task_add(struct rtc_level * pLevel, struct rtc_task * pTask);
+
+    return (i32p_t)_impl_rtc_task_add(pLevel, pTask);
+}
+
+/**
+ * @brief Post an event to the run-to-completion task, it can be called in the interrupt content.
+ *
+ * @param pTask The pointer of the run-to-completion task.
+ * @param event The event value that's passed to the task handler.
+ *
+ * @return The result of the operation, it fails when the task event ring is full.
+ */
+static inline i32p_t os_rtc_post(os_rtc_task_t *pTask, u32_t event)
+{
+    extern i32p_t _impl_rtc_post(struct rtc_task * pTask, u32_t event);
+
+    return (i32p_t)_impl_rtc_post(pTask, event);
+}
+
+/**
+ * @brief Handle the posted events of the level tasks in the calling thread, it never returns. The OS_RTC_LEVEL_INIT defines the thread
+ * that calls it.
+ *
+ * @param pLevel The pointer of the run-to-completion level.
+ *
+ * @return The result of the operation if the level can't be run.
+ */
+static inline i32p_t os_rtc_level_run(os_rtc_level_t *pLevel)
+{
+    extern i32p_t _impl_rtc_level_run(struct rtc_level * pLevel);
+
+    return (i32p_t)_impl_rtc_level_run(pLevel);
+}
+
 /**
  * @brief Idle thread callback function register.
  *
@@ -191,6 +483,7 @@ static inline os_timer_id_t os_timer_init(pTimer_callbackFunc_t pEntryFun, const
 
 /**
  * @brief Allocate a temporary timer to run and release it when it stops.
+ *        The released temporary timer is recycled in constant time, and it's safe to be called in the interrupt context.
  *
  * @param pCallFun The timer entry function pointer.
  * @param pName The timer's name, it supported NULL pointer.
@@ -239,6 +532,49 @@ static inline i32p_t os_timer_stop(os_timer_id_t id)
     return (i32p_t)_impl_timer_stop(id.u32_val);
 }
 
+/**
+ * @brief Set the timer slack, the timer expiry can be delayed within it to share the clock interrupt with others.
+ *
+ * @param id The timer unique id.
+ * @param slack_ms The timer slack time, it is up to 4294967 ms.
+ *
+ * @return The result of timer slack operation.
+ */
+static inline i32p_t os_timer_slack_set(os_timer_id_t id, u32_t slack_ms)
+{
+    extern i32p_t _impl_timer_slack_set(u32_t ctx, u32_t slack_ms);
+
+    return (i32p_t)_impl_timer_slack_set(id.u32_val, slack_ms);
+}
+
+/**
+ * @brief Get the missed periods of the cycle timer since it started, it helps to detect the drift.
+ *
+ * @param id The timer unique id.
+ *
+ * @return The value of the overrun counter.
+ */
+static inline u32_t os_timer_overrun_get(os_timer_id_t id)
+{
+    extern u32_t _impl_timer_overrun_get(u32_t ctx);
+
+    return (u32_t)_impl_timer_overrun_get(id.u32_val);
+}
+
+/**
+ * @brief Take the timer statistics snapshot, it shows the clock interrupts saved by the slack coalescing.
+ *
+ * @param pStatistics The pointer of the timer statistics.
+ *
+ * @return The result of the operation.
+ */
+static inline i32p_t os_timer_statistics_get(os_timer_statistics_t *pStatistics)
+{
+    extern i32p_t _impl_timer_statistics_get(struct timer_statistics * pStatistics);
+
+    return (i32p_t)_impl_timer_statistics_get(pStatistics);
+}
+
 /**
  * @brief Check the timer to confirm if it's already scheduled in the waiting list.
  *
@@ -258,119 +594,421 @@ static inline i32p_t os_timer_busy(os_timer_id_t id)
  *
  * @return The value of the total system time (ms).
  */
-static inline u32_t os_timer_system_total_ms(void)
+static inline u32_t os_timer_system_total_ms(void)
+{
+    extern u32_t _impl_timer_total_system_ms_get(void);
+
+    return (u32_t)_impl_timer_total_system_ms_get();
+}
+
+/**
+ * @brief Initialize a new semaphore.
+ *
+ * @param remain The initial count that allows the system take.
+ * @param limit The maximum count that it's the semaphore's limitation.
+ * @param pName The semaphore name.
+ *
+ * @return The semaphore unique id.
+ */
+static inline os_sem_id_t os_sem_init(u8_t remain, u8_t limit, const char_t *pName)
+{
+    extern u32_t _impl_semaphore_init(u8_t remainCount, u8_t limitCount, const char_t *pName);
+
+    os_sem_id_t id = {0u};
+    id.u32_val = _impl_semaphore_init(remain, limit, pName);
+    id.pName = pName;
+
+    return id;
+}
+
+/**
+ * @brief Take a semaphore count away with timeout option.
+ *
+ * @param id The semaphore unique id.
+ * @param timeout_ms The semaphore take timeout option, the OS_TIME_NOWAIT returns OS_PC_TIMEOUT at once if no count is available.
+ *
+ * @return The result of the operation.
+ */
+static inline i32p_t os_sem_take(os_sem_id_t id, u32_t timeout_ms)
+{
+    extern i32p_t _impl_semaphore_take(u32_t ctx, u32_t timeout_ms);
+
+    return (i32p_t)_impl_semaphore_take(id.u32_val, timeout_ms);
+}
+
+/**
+ * @brief Give the semaphore to release the avaliable count.
+ *
+ * @param id The semaphore unique id.
+ *
+ * @return The result of the operation.
+ */
+static inline i32p_t os_sem_give(os_sem_id_t id)
+{
+    extern i32p_t _impl_semaphore_give(u32_t ctx);
+
+    return (i32p_t)_impl_semaphore_give(id.u32_val);
+}
+
+/**
+ * @brief Flush the semaphore to release all the avaliable count.
+ *
+ * @param id The semaphore unique id.
+ *
+ * @return The result of the operation.
+ */
+static inline i32p_t os_sem_flush(os_sem_id_t id)
+{
+    extern i32p_t _impl_semaphore_flush(u32_t ctx);
+
+    return (i32p_t)_impl_semaphore_flush(id.u32_val);
+}
+
+/**
+ * @brief Initialize a new mutex.
+ *
+ * @param pName The mutex name.
+ *
+ * @return The mutex unique id.
+ */
+static inline os_mutex_id_t os_mutex_init(const char_t *pName)
+{
+    extern u32_t _impl_mutex_init(const char_t *pName);
+
+    os_mutex_id_t id = {0u};
+    id.u32_val = _impl_mutex_init(pName);
+    id.pName = pName;
+
+    return id;
+}
+
+/**
+ * @brief Initialize a new recursive mutex, the hold task can lock it again and it must unlock it the same times.
+ *
+ * @param pName The mutex name.
+ *
+ * @return The mutex unique id.
+ */
+static inline os_mutex_id_t os_mutex_recursive_init(const char_t *pName)
+{
+    extern u32_t _impl_mutex_recursive_init(const char_t *pName);
+
+    os_mutex_id_t id = {0u};
+    id.u32_val = _impl_mutex_recursive_init(pName);
+    id.pName = pName;
+
+    return id;
+}
+
+/**
+ * @brief Initialize a new adaptive mutex, the contended lock yields to the ready hold thread of the same priority before it's blocked.
+ * The hold thread of the other priority takes the priority inheritance as the normal mutex.
+ *
+ * @param pName The mutex name.
+ *
+ * @return The mutex unique id.
+ */
+static inline os_mutex_id_t os_mutex_adaptive_init(const char_t *pName)
+{
+    extern u32_t _impl_mutex_adaptive_init(const char_t *pName);
+
+    os_mutex_id_t id = {0u};
+    id.u32_val = _impl_mutex_adaptive_init(pName);
+    id.pName = pName;
+
+    return id;
+}
+
+/**
+ * @brief Mutex lock to avoid another thread access this resource.
+ *
+ * @param id The mutex unique id.
+ *
+ * @return The result of the operation.
+ */
+static inline i32p_t os_mutex_lock(os_mutex_id_t id)
+{
+    extern i32p_t _impl_mutex_lock(u32_t ctx);
+
+    return (i32p_t)_impl_mutex_lock(id.u32_val);
+}
+
+/**
+ * @brief Mutex lock with the timeout to avoid another thread access this resource.
+ *
+ * @param id The mutex unique id.
+ * @param timeout_ms The mutex lock timeout setting.
+ *
+ * @return The result of the operation.
+ */
+static inline i32p_t os_mutex_lock_timeout(os_mutex_id_t id, os_timeout_t timeout_ms)
+{
+    extern i32p_t _impl_mutex_lock_timeout(u32_t ctx, u32_t timeout_ms);
+
+    return (i32p_t)_impl_mutex_lock_timeout(id.u32_val, (u32_t)timeout_ms);
+}
+
+/**
+ * @brief Mutex unlock to allow another access the resource.
+ *
+ * @param id The mutex unique id.
+ *
+ * @return The result of the operation.
+ */
+static inline i32p_t os_mutex_unlock(os_mutex_id_t id)
+{
+    extern i32p_t _impl_mutex_unlock(u32_t ctx);
+
+    return (i32p_t)_impl_mutex_unlock(id.u32_val);
+}
+
+/**
+ * @brief Take the mutex statistics snapshot, it shows the yield success versus the block rates.
+ *
+ * @param id The mutex unique id.
+ * @param pStatistics The pointer of the mutex statistics.
+ *
+ * @return The result of the operation.
+ */
+static inline i32p_t os_mutex_statistics_get(os_mutex_id_t id, os_mutex_statistics_t *pStatistics)
+{
+    extern i32p_t _impl_mutex_statistics_get(u32_t ctx, struct mutex_statistics * pStatistics);
+
+    return (i32p_t)_impl_mutex_statistics_get(id.u32_val, pStatistics);
+}
+
+/**
+ * @brief Initialize a new condition variable.
+ *
+ * @param pName The condition variable name.
+ *
+ * @return The condition variable unique id.
+ */
+static inline os_cond_id_t os_cond_init(const char_t *pName)
+{
+    extern u32_t _impl_cond_init(const char_t *pName);
+
+    os_cond_id_t id = {0u};
+    id.u32_val = _impl_cond_init(pName);
+    id.pName = pName;
+
+    return id;
+}
+
+/**
+ * @brief Release the locked mutex and wait for the condition, the mutex is locked again when it returns.
+ *
+ * @param id The condition variable unique id.
+ * @param mutex The mutex unique id that the current thread holds.
+ * @param timeout_ms The condition waiting timeout setting.
+ *
+ * @return The result of the operation.
+ */
+static inline i32p_t os_cond_wait(os_cond_id_t id, os_mutex_id_t mutex, os_timeout_t timeout_ms)
+{
+    extern i32p_t _impl_cond_wait(u32_t ctx, u32_t mutex, u32_t timeout_ms);
+
+    return (i32p_t)_impl_cond_wait(id.u32_val, mutex.u32_val, (u32_t)timeout_ms);
+}
+
+/**
+ * @brief Move the highest priority waiter of the condition to its mutex.
+ *
+ * @param id The condition variable unique id.
+ *
+ * @return The result of the operation.
+ */
+static inline i32p_t os_cond_signal(os_cond_id_t id)
+{
+    extern i32p_t _impl_cond_signal(u32_t ctx);
+
+    return (i32p_t)_impl_cond_signal(id.u32_val);
+}
+
+/**
+ * @brief Move all waiters of the condition to their mutex.
+ *
+ * @param id The condition variable unique id.
+ *
+ * @return The result of the operation.
+ */
+static inline i32p_t os_cond_broadcast(os_cond_id_t id)
+{
+    extern i32p_t _impl_cond_broadcast(u32_t ctx);
+
+    return (i32p_t)_impl_cond_broadcast(id.u32_val);
+}
+
+/**
+ * @brief Initialize a new barrier.
+ *
+ * @param parties The thread number that must arrive to release the barrier.
+ * @param pName The barrier name.
+ *
+ * @return The barrier unique id.
+ */
+static inline os_barrier_id_t os_barrier_init(u16_t parties, const char_t *pName)
+{
+    extern u32_t _impl_barrier_init(u16_t parties, const char_t *pName);
+
+    os_barrier_id_t id = {0u};
+    id.u32_val = _impl_barrier_init(parties, pName);
+    id.pName = pName;
+
+    return id;
+}
+
+/**
+ * @brief Arrive at the barrier and wait until all parties arrived.
+ *
+ * @param id The barrier unique id.
+ * @param timeout_ms The barrier waiting timeout setting.
+ *
+ * @return The result of the operation.
+ */
+static inline i32p_t os_barrier_wait(os_barrier_id_t id, os_timeout_t timeout_ms)
 {
-    extern u32_t _impl_timer_total_system_ms_get(void);
+    extern i32p_t _impl_barrier_wait(u32_t ctx, u32_t timeout_ms);
 
-    return (u32_t)_impl_timer_total_system_ms_get();
+    return (i32p_t)_impl_barrier_wait(id.u32_val, (u32_t)timeout_ms);
 }
 
 /**
- * @brief Initialize a new semaphore.
+ * @brief Initialize a new countdown latch.
  *
- * @param remain The initial count that allows the system take.
- * @param limit The maximum count that it's the semaphore's limitation.
- * @param pName The semaphore name.
+ * @param count The count down number to release the waiters.
+ * @param pName The latch name.
  *
- * @return The semaphore unique id.
+ * @return The latch unique id.
  */
-static inline os_sem_id_t os_sem_init(u8_t remain, u8_t limit, const char_t *pName)
+static inline os_latch_id_t os_latch_init(u32_t count, const char_t *pName)
 {
-    extern u32_t _impl_semaphore_init(u8_t remainCount, u8_t limitCount, const char_t *pName);
+    extern u32_t _impl_latch_init(u32_t count, const char_t *pName);
 
-    os_sem_id_t id = {0u};
-    id.u32_val = _impl_semaphore_init(remain, limit, pName);
+    os_latch_id_t id = {0u};
+    id.u32_val = _impl_latch_init(count, pName);
     id.pName = pName;
 
     return id;
 }
 
 /**
- * @brief Take a semaphore count away with timeout option.
+ * @brief Count the latch down, the last one releases all waiters.
  *
- * @param id The semaphore unique id.
+ * @param id The latch unique id.
  *
  * @return The result of the operation.
  */
-static inline i32p_t os_sem_take(os_sem_id_t id, u32_t timeout_ms)
+static inline i32p_t os_latch_count_down(os_latch_id_t id)
 {
-    extern i32p_t _impl_semaphore_take(u32_t ctx, u32_t timeout_ms);
+    extern i32p_t _impl_latch_count_down(u32_t ctx);
 
-    return (i32p_t)_impl_semaphore_take(id.u32_val, timeout_ms);
+    return (i32p_t)_impl_latch_count_down(id.u32_val);
 }
 
 /**
- * @brief Give the semaphore to release the avaliable count.
+ * @brief Wait until the latch is counted down to zero.
  *
- * @param id The semaphore unique id.
+ * @param id The latch unique id.
+ * @param timeout_ms The latch waiting timeout setting.
  *
  * @return The result of the operation.
  */
-static inline i32p_t os_sem_give(os_sem_id_t id)
+static inline i32p_t os_latch_wait(os_latch_id_t id, os_timeout_t timeout_ms)
 {
-    extern i32p_t _impl_semaphore_give(u32_t ctx);
+    extern i32p_t _impl_latch_wait(u32_t ctx, u32_t timeout_ms);
 
-    return (i32p_t)_impl_semaphore_give(id.u32_val);
+    return (i32p_t)_impl_latch_wait(id.u32_val, (u32_t)timeout_ms);
 }
 
 /**
- * @brief Flush the semaphore to release all the avaliable count.
+ * @brief Get the remaining count of the latch.
  *
- * @param id The semaphore unique id.
+ * @param id The latch unique id.
  *
- * @return The result of the operation.
+ * @return The remaining count.
  */
-static inline i32p_t os_sem_flush(os_sem_id_t id)
+static inline u32_t os_latch_count_get(os_latch_id_t id)
 {
-    extern i32p_t _impl_semaphore_flush(u32_t ctx);
+    extern u32_t _impl_latch_count_get(u32_t ctx);
 
-    return (i32p_t)_impl_semaphore_flush(id.u32_val);
+    return (u32_t)_impl_latch_count_get(id.u32_val);
 }
 
 /**
- * @brief Initialize a new mutex.
+ * @brief Initialize a new reader-writer lock.
  *
- * @param pName The mutex name.
+ * @param pName The rwlock name.
  *
- * @return The mutex unique id.
+ * @return The rwlock unique id.
  */
-static inline os_mutex_id_t os_mutex_init(const char_t *pName)
+static inline os_rwlock_id_t os_rwlock_init(const char_t *pName)
 {
-    extern u32_t _impl_mutex_init(const char_t *pName);
+    extern u32_t _impl_rwlock_init(const char_t *pName);
 
-    os_mutex_id_t id = {0u};
-    id.u32_val = _impl_mutex_init(pName);
+    os_rwlock_id_t id = {0u};
+    id.u32_val = _impl_rwlock_init(pName);
     id.pName = pName;
 
     return id;
 }
 
 /**
- * @brief Mutex lock to avoid another thread access this resource.
+ * @brief Take the shared read lock, the waiting writer has the preference over the new readers.
  *
- * @param id The mutex unique id.
+ * @param id The rwlock unique id.
+ * @param timeout_ms The read lock timeout setting.
  *
  * @return The result of the operation.
  */
-static inline i32p_t os_mutex_lock(os_mutex_id_t id)
+static inline i32p_t os_rwlock_read_lock(os_rwlock_id_t id, os_timeout_t timeout_ms)
 {
-    extern i32p_t _impl_mutex_lock(u32_t ctx);
+    extern i32p_t _impl_rwlock_read_lock(u32_t ctx, u32_t timeout_ms);
 
-    return (i32p_t)_impl_mutex_lock(id.u32_val);
+    return (i32p_t)_impl_rwlock_read_lock(id.u32_val, (u32_t)timeout_ms);
 }
 
 /**
- * @brief Mutex unlock to allow another access the resource.
+ * @brief Release the shared read lock.
  *
- * @param id The mutex unique id.
+ * @param id The rwlock unique id.
  *
  * @return The result of the operation.
  */
-static inline i32p_t os_mutex_unlock(os_mutex_id_t id)
+static inline i32p_t os_rwlock_read_unlock(os_rwlock_id_t id)
 {
-    extern i32p_t _impl_mutex_unlock(u32_t ctx);
+    extern i32p_t _impl_rwlock_read_unlock(u32_t ctx);
 
-    return (i32p_t)_impl_mutex_unlock(id.u32_val);
+    return (i32p_t)_impl_rwlock_read_unlock(id.u32_val);
+}
+
+/**
+ * @brief Take the exclusive write lock.
+ *
+ * @param id The rwlock unique id.
+ * @param timeout_ms The write lock timeout setting.
+ *
+ * @return The result of the operation.
+ */
+static inline i32p_t os_rwlock_write_lock(os_rwlock_id_t id, os_timeout_t timeout_ms)
+{
+    extern i32p_t _impl_rwlock_write_lock(u32_t ctx, u32_t timeout_ms);
+
+    return (i32p_t)_impl_rwlock_write_lock(id.u32_val, (u32_t)timeout_ms);
+}
+
+/**
+ * @brief Release the exclusive write lock.
+ *
+ * @param id The rwlock unique id.
+ *
+ * @return The result of the operation.
+ */
+static inline i32p_t os_rwlock_write_unlock(os_rwlock_id_t id)
+{
+    extern i32p_t _impl_rwlock_write_unlock(u32_t ctx);
+
+    return (i32p_t)_impl_rwlock_write_unlock(id.u32_val);
 }
 
 /**
@@ -434,7 +1072,7 @@ static inline i32p_t os_evt_set(os_evt_id_t id, u32_t set, u32_t clear, u32_t to
  * @param id The event unique id.
  * @param pEvtData The pointer of event value.
  * @param listen_mask Current thread listen which bits in the event.
- * @param timeout_ms The event wait timeout setting.
+ * @param timeout_ms The event wait timeout setting, the OS_TIME_NOWAIT returns OS_PC_TIMEOUT at once if the event is not triggered.
  *
  * @return The result of the operation.
  */
@@ -445,6 +1083,79 @@ static inline i32p_t os_evt_wait(os_evt_id_t id, os_evt_val_t *pEvtData, u32_t l
     return (i32p_t)_impl_event_wait(id.u32_val, pEvtData, listen_mask, (u32_t)timeout_ms);
 }
 
+/**
+ * @brief Initialize a new wide event, each mask has OS_EVT_WORD_NUMBER words.
+ *
+ * @param pAnyMask: Changed bits always trigger = 1. otherwise, see dirMask below = 0.
+ * @param pModeMask: Level trigger = 0, Edge trigger = 1.
+ * @param pDirMask: Fall or Low trigger = 0, Rise or high trigger = 1.
+ * @param pInit: The init signal value.
+ * @param pName: The event name.
+ *
+ * @return The event unique id.
+ */
+static inline os_evt_id_t os_evt_wide_init(const u32_t *pAnyMask, const u32_t *pModeMask, const u32_t *pDirMask, const u32_t *pInit,
+                                           const char_t *pName)
+{
+    extern u32_t _impl_event_wide_init(const u32_t *pAnyMask, const u32_t *pModeMask, const u32_t *pDirMask, const u32_t *pInit,
+                                       const char_t *pName);
+
+    os_evt_id_t id = {0u};
+    id.u32_val = _impl_event_wide_init(pAnyMask, pModeMask, pDirMask, pInit, pName);
+    id.pName = pName;
+
+    return id;
+}
+
+/**
+ * @brief Read the whole wide event signal value words.
+ *
+ * @param id: Event unique id.
+ * @param pValue: The pointer of the private event value words.
+ *
+ * @return The result of the operation.
+ */
+static inline i32p_t os_evt_wide_value_get(os_evt_id_t id, u32_t *pValue)
+{
+    extern i32p_t _impl_event_wide_value_get(u32_t ctx, u32_t * pValue);
+
+    return (i32p_t)_impl_event_wide_value_get(id.u32_val, pValue);
+}
+
+/**
+ * @brief Set/clear/toggle the wide event bits, the NULL pointer means no bits changed.
+ *
+ * @param id The event unique id.
+ * @param pSet The event value words set.
+ * @param pClear The event value words clear.
+ * @param pToggle The event value words toggle.
+ *
+ * @return The result of the operation.
+ */
+static inline i32p_t os_evt_wide_set(os_evt_id_t id, const u32_t *pSet, const u32_t *pClear, const u32_t *pToggle)
+{
+    extern i32p_t _impl_event_wide_set(u32_t ctx, const u32_t *pSet, const u32_t *pClear, const u32_t *pToggle);
+
+    return (i32p_t)_impl_event_wide_set(id.u32_val, pSet, pClear, pToggle);
+}
+
+/**
+ * @brief Wait a trigger wide event.
+ *
+ * @param id The event unique id.
+ * @param pEvtData The pointer of wide event value.
+ * @param pListen Current thread listen which bits in the event words.
+ * @param timeout_ms The event wait timeout setting, the OS_TIME_NOWAIT returns OS_PC_TIMEOUT at once if the event is not triggered.
+ *
+ * @return The result of the operation.
+ */
+static inline i32p_t os_evt_wide_wait(os_evt_id_t id, os_evt_wide_val_t *pEvtData, const u32_t *pListen, os_timeout_t timeout_ms)
+{
+    extern i32p_t _impl_event_wide_wait(u32_t ctx, struct evt_wide_val * pEvtData, const u32_t *pListen, u32_t timeout_ms);
+
+    return (i32p_t)_impl_event_wide_wait(id.u32_val, pEvtData, pListen, (u32_t)timeout_ms);
+}
+
 /**
  * @brief Initialize a new queue.
  *
@@ -473,7 +1184,7 @@ static inline os_msgq_id_t os_msgq_init(const void *pBufferAddr, u16_t len, u16_
  * @param pUserBuffer The pointer of the message buffer address.
  * @param size The queue buffer size.
  * @param isToFront The direction of the message operation.
- * @param timeout_ms The queue send timeout option.
+ * @param timeout_ms The queue send timeout option, the OS_TIME_NOWAIT returns OS_PC_TIMEOUT at once if the queue is full.
  *
  * @return The result of the operation.
  */
@@ -491,7 +1202,7 @@ static inline i32p_t os_msgq_put(os_msgq_id_t id, const u8_t *pUserBuffer, u16_t
  * @param pUserBuffer The pointer of the message buffer address.
  * @param size The queue buffer size.
  * @param isFromBack The direction of the message operation.
- * @param timeout_ms The queue send timeout option.
+ * @param timeout_ms The queue receive timeout option, the OS_TIME_NOWAIT returns OS_PC_TIMEOUT at once if the queue is empty.
  *
  * @return The result of the operation.
  */
@@ -502,6 +1213,155 @@ static inline i32p_t os_msgq_get(os_msgq_id_t id, const u8_t *pUserBuffer, u16_t
     return (i32p_t)_impl_queue_receive(id.u32_val, pUserBuffer, size, isFromBack, (u32_t)timeout_ms);
 }
 
+/**
+ * @brief Initialize a new priority queue, the message with the higher priority is received first.
+ *
+ * @param pBufferAddr The pointer of the queue buffer, its size is OS_MSGQ_PRIORITY_BUFFER_SIZE(len, num).
+ * @param len The element size.
+ * @param num The element number.
+ * @param pName The queue name.
+ *
+ * @return The queue unique id.
+ */
+static inline os_msgq_id_t os_msgq_priority_init(const void *pBufferAddr, u16_t len, u16_t num, const char_t *pName)
+{
+    extern u32_t _impl_queue_priority_init(const void *pQueueBufferAddr, u16_t elementLen, u16_t elementNum, const char_t *pName);
+
+    os_msgq_id_t id = {0u};
+    id.u32_val = _impl_queue_priority_init(pBufferAddr, len, num, pName);
+    id.pName = pName;
+
+    return id;
+}
+
+/**
+ * @brief Send a queue message with its priority, os_msgq_put() sends the lowest priority message.
+ *
+ * @param id The queue unique id.
+ * @param pUserBuffer The pointer of the message buffer address.
+ * @param size The queue buffer size.
+ * @param priority The message priority, the zero is the highest and it's less than OS_MSGQ_PRIORITY_NUMBER.
+ * @param isToFront The message is put in front of the same priority messages.
+ * @param timeout_ms The queue send timeout option, the OS_TIME_NOWAIT returns OS_PC_TIMEOUT at once if the queue is full.
+ *
+ * @return The result of the operation.
+ */
+static inline i32p_t os_msgq_priority_put(os_msgq_id_t id, const u8_t *pUserBuffer, u16_t size, u8_t priority, b_t isToFront,
+                                          os_timeout_t timeout_ms)
+{
+    extern i32p_t _impl_queue_priority_send(u32_t ctx, const u8_t *pUserBuffer, u16_t bufferSize, u8_t priority, b_t isToFront,
+                                            u32_t timeout_ms);
+
+    return (i32p_t)_impl_queue_priority_send(id.u32_val, pUserBuffer, size, priority, isToFront, (u32_t)timeout_ms);
+}
+
+/**
+ * @brief Initialize a new byte stream buffer.
+ *
+ * @param pBufferAddr The pointer of the ring buffer.
+ * @param size The ring buffer size.
+ * @param trigger The cached byte number that wakes up the blocked reader, it is up to the ring buffer size.
+ * @param pName The stream name.
+ *
+ * @return The stream unique id.
+ */
+static inline os_stream_id_t os_stream_init(void *pBufferAddr, u32_t size, u32_t trigger, const char_t *pName)
+{
+    extern u32_t _impl_stream_init(void *pBufferAddr, u32_t size, u32_t trigger, b_t isMessage, const char_t *pName);
+
+    os_stream_id_t id = {0u};
+    id.u32_val = _impl_stream_init(pBufferAddr, size, trigger, false, pName);
+    id.pName = pName;
+
+    return id;
+}
+
+/**
+ * @brief Initialize a new message buffer, each message is stored with its length and is received as a whole.
+ *
+ * @param pBufferAddr The pointer of the ring buffer.
+ * @param size The ring buffer size.
+ * @param pName The message buffer name.
+ *
+ * @return The stream unique id.
+ */
+static inline os_stream_id_t os_msgbuf_init(void *pBufferAddr, u32_t size, const char_t *pName)
+{
+    extern u32_t _impl_stream_init(void *pBufferAddr, u32_t size, u32_t trigger, b_t isMessage, const char_t *pName);
+
+    os_stream_id_t id = {0u};
+    id.u32_val = _impl_stream_init(pBufferAddr, size, 1u, true, pName);
+    id.pName = pName;
+
+    return id;
+}
+
+/**
+ * @brief Send the data into the stream, or a single message into the message buffer.
+ *
+ * @param id The stream unique id.
+ * @param pData The pointer of the data.
+ * @param len The data length.
+ * @param timeout_ms The stream send timeout option, the OS_TIME_NOWAIT returns OS_PC_TIMEOUT at once if the data doesn't fit.
+ *
+ * @return The result of the operation.
+ */
+static inline i32p_t os_stream_send(os_stream_id_t id, const u8_t *pData, u32_t len, os_timeout_t timeout_ms)
+{
+    extern i32p_t _impl_stream_send(u32_t ctx, const u8_t *pData, u32_t len, u32_t timeout_ms);
+
+    return (i32p_t)_impl_stream_send(id.u32_val, pData, len, (u32_t)timeout_ms);
+}
+
+/**
+ * @brief Receive the data from the stream, or the next message from the message buffer.
+ *
+ * @param id The stream unique id.
+ * @param pBuffer The pointer of the user buffer.
+ * @param size The user buffer size.
+ * @param pLength The pointer of the received byte number.
+ * @param timeout_ms The stream receive timeout option, the OS_TIME_NOWAIT returns OS_PC_TIMEOUT at once if the stream is empty.
+ *
+ * @return The result of the operation.
+ */
+static inline i32p_t os_stream_receive(os_stream_id_t id, u8_t *pBuffer, u32_t size, u32_t *pLength, os_timeout_t timeout_ms)
+{
+    extern i32p_t _impl_stream_receive(u32_t ctx, u8_t *pBuffer, u32_t size, u32_t *pLength, u32_t timeout_ms);
+
+    return (i32p_t)_impl_stream_receive(id.u32_val, pBuffer, size, pLength, (u32_t)timeout_ms);
+}
+
+/**
+ * @brief Read the next data in place without the copy, it's released by os_stream_consume().
+ *
+ * @param id The stream unique id.
+ * @param ppData The pointer of the data address in the ring.
+ * @param pLength The pointer of the contiguous byte number, or the next message length.
+ *
+ * @return The result of the operation.
+ */
+static inline i32p_t os_stream_peek(os_stream_id_t id, const u8_t **ppData, u32_t *pLength)
+{
+    extern i32p_t _impl_stream_peek(u32_t ctx, const u8_t **ppData, u32_t *pLength);
+
+    return (i32p_t)_impl_stream_peek(id.u32_val, ppData, pLength);
+}
+
+/**
+ * @brief Release the data that was read in place.
+ *
+ * @param id The stream unique id.
+ * @param len The consumed byte number, the message buffer always consumes the whole next message.
+ *
+ * @return The result of the operation.
+ */
+static inline i32p_t os_stream_consume(os_stream_id_t id, u32_t len)
+{
+    extern i32p_t _impl_stream_consume(u32_t ctx, u32_t len);
+
+    return (i32p_t)_impl_stream_consume(id.u32_val, len);
+}
+
 /**
  * @brief Initialize a new pool.
  *
@@ -754,6 +1614,96 @@ static inline void os_trace_analyze(const pTrace_analyzeFunc_t fn)
     _impl_trace_analyze(fn);
 }
 
+/**
+ * @brief Trace At-RTOS each deadline thread jobs and deadline misses, it's valid when the THREAD_DEADLINE_ENABLED is set.
+ *
+ * @param fn The invoke function.
+ */
+static inline void os_trace_foreach_deadline(const pTrace_deadlineFunc_t fn)
+{
+    _impl_trace_deadline(fn);
+}
+
+/**
+ * @brief Take the lazy FPU context switch statistics snapshot, it shows the FPU context saves avoided.
+ *
+ * @param pStatistics The pointer of the FPU statistics.
+ *
+ * @return The result of the operation, it fails if the FPU_LAZY_SWITCH_ENABLED is disabled.
+ */
+static inline i32p_t os_trace_fpu_statistics_get(os_fpu_statistics_t *pStatistics)
+{
+    extern i32p_t _impl_kernel_fpu_statistics_get(struct fpu_statistics * pStatistics);
+
+    return (i32p_t)_impl_kernel_fpu_statistics_get(pStatistics);
+}
+
+/**
+ * @brief Trace At-RTOS each mutex contention statistics, it's valid when the TRACE_CONTENTION_ENABLED is set.
+ *
+ * @param fn The invoke function.
+ */
+static inline void os_trace_foreach_mutex(const pTrace_contentionFunc_t fn)
+{
+    _impl_trace_mutex(fn);
+}
+
+/**
+ * @brief Trace At-RTOS each semaphore contention statistics, it's valid when the TRACE_CONTENTION_ENABLED is set.
+ *
+ * @param fn The invoke function.
+ */
+static inline void os_trace_foreach_sem(const pTrace_contentionFunc_t fn)
+{
+    _impl_trace_semaphore(fn);
+}
+
+/**
+ * @brief Trace At-RTOS each message queue contention statistics, it's valid when the TRACE_CONTENTION_ENABLED is set.
+ *
+ * @param fn The invoke function.
+ */
+static inline void os_trace_foreach_msgq(const pTrace_contentionFunc_t fn)
+{
+    _impl_trace_queue(fn);
+}
+
+/**
+ * @brief Trace At-RTOS each thread wake-to-run latency, it's valid when the TRACE_SCHEDULE_LATENCY_ENABLED is set.
+ *
+ * @param fn The invoke function.
+ */
+static inline void os_trace_thread_latency(const pTrace_latencyFunc_t fn)
+{
+    _impl_trace_thread_latency(fn);
+}
+
+/**
+ * @brief Clean At-RTOS thread wake-to-run latency statistics.
+ */
+static inline void os_trace_thread_latency_reset(void)
+{
+    _impl_trace_thread_latency_reset();
+}
+
+/**
+ * @brief Trace At-RTOS each critical section call site profile, it's valid when the TRACE_CRITICAL_SECTION_ENABLED is set.
+ *
+ * @param fn The invoke function.
+ */
+static inline void os_trace_critical_section(const pTrace_criticalFunc_t fn)
+{
+    _impl_trace_critical_section(fn);
+}
+
+/**
+ * @brief Clean At-RTOS critical section profile statistics.
+ */
+static inline void os_trace_critical_section_reset(void)
+{
+    _impl_trace_critical_section_reset();
+}
+
 /* It defined the AtOS extern symbol for convenience use, but it has extra memory consumption */
 #if (OS_API_ENABLE)
 typedef struct {
@@ -763,13 +1713,26 @@ typedef struct {
     i32p_t (*thread_suspend)(os_thread_id_t);
     i32p_t (*thread_yield)(void);
     i32p_t (*thread_delete)(os_thread_id_t);
+    i32p_t (*thread_deadline_set)(os_thread_id_t, u32_t, u32_t);
+    i32p_t (*thread_deadline_wait)(void);
+    i32p_t (*thread_budget_set)(os_thread_id_t, u32_t, u32_t);
     void (*thread_idle_fn_register)(const pThread_entryFunc_t);
 
+    i32p_t (*coroutine_add)(os_coroutine_group_t *, os_coroutine_t *);
+    i32p_t (*coroutine_group_run)(os_coroutine_group_t *);
+    i32p_t (*coroutine_notify)(os_coroutine_group_t *);
+
+    i32p_t (*rtc_task_add)(os_rtc_level_t *, os_rtc_task_t *);
+    i32p_t (*rtc_post)(os_rtc_task_t *, u32_t);
+
     os_timer_id_t (*timer_init)(pTimer_callbackFunc_t, const char_t *);
     os_timer_id_t (*timer_automatic)(pTimer_callbackFunc_t, const char_t *);
     i32p_t (*timer_start)(os_timer_id_t, os_timer_ctrl_t, os_timeout_t);
     i32p_t (*timer_stop)(os_timer_id_t);
     i32p_t (*timer_busy)(os_timer_id_t);
+    i32p_t (*timer_slack_set)(os_timer_id_t, u32_t);
+    u32_t (*timer_overrun_get)(os_timer_id_t);
+    i32p_t (*timer_statistics_get)(os_timer_statistics_t *);
     u32_t (*timer_system_total_ms)(void);
 
     os_sem_id_t (*sem_init)(u8_t, u8_t, const char_t *);
@@ -780,14 +1743,49 @@ typedef struct {
     os_mutex_id_t (*mutex_init)(const char_t *);
     i32p_t (*mutex_lock)(os_mutex_id_t);
     i32p_t (*mutex_unlock)(os_mutex_id_t);
+    os_mutex_id_t (*mutex_recursive_init)(const char_t *);
+    i32p_t (*mutex_lock_timeout)(os_mutex_id_t, os_timeout_t);
+    os_mutex_id_t (*mutex_adaptive_init)(const char_t *);
+    i32p_t (*mutex_statistics_get)(os_mutex_id_t, os_mutex_statistics_t *);
+
+    os_rwlock_id_t (*rwlock_init)(const char_t *);
+    i32p_t (*rwlock_read_lock)(os_rwlock_id_t, os_timeout_t);
+    i32p_t (*rwlock_read_unlock)(os_rwlock_id_t);
+    i32p_t (*rwlock_write_lock)(os_rwlock_id_t, os_timeout_t);
+    i32p_t (*rwlock_write_unlock)(os_rwlock_id_t);
+
+    os_cond_id_t (*cond_init)(const char_t *);
+    i32p_t (*cond_wait)(os_cond_id_t, os_mutex_id_t, os_timeout_t);
+    i32p_t (*cond_signal)(os_cond_id_t);
+    i32p_t (*cond_broadcast)(os_cond_id_t);
+
+    os_barrier_id_t (*barrier_init)(u16_t, const char_t *);
+    i32p_t (*barrier_wait)(os_barrier_id_t, os_timeout_t);
+    os_latch_id_t (*latch_init)(u32_t, const char_t *);
+    i32p_t (*latch_count_down)(os_latch_id_t);
+    i32p_t (*latch_wait)(os_latch_id_t, os_timeout_t);
+    u32_t (*latch_count_get)(os_latch_id_t);
 
     os_evt_id_t (*evt_init)(u32_t, u32_t, u32_t, u32_t, const char_t *);
     i32p_t (*evt_set)(os_evt_id_t, u32_t, u32_t, u32_t);
     i32p_t (*evt_wait)(os_evt_id_t, os_evt_val_t *, u32_t, os_timeout_t);
+    os_evt_id_t (*evt_wide_init)(const u32_t *, const u32_t *, const u32_t *, const u32_t *, const char_t *);
+    i32p_t (*evt_wide_value_get)(os_evt_id_t, u32_t *);
+    i32p_t (*evt_wide_set)(os_evt_id_t, const u32_t *, const u32_t *, const u32_t *);
+    i32p_t (*evt_wide_wait)(os_evt_id_t, os_evt_wide_val_t *, const u32_t *, os_timeout_t);
 
     os_msgq_id_t (*msgq_init)(const void *, u16_t, u16_t, const char_t *);
     i32p_t (*msgq_put)(os_msgq_id_t, const u8_t *, u16_t, b_t, os_timeout_t);
     i32p_t (*msgq_get)(os_msgq_id_t, const u8_t *, u16_t, b_t, os_timeout_t);
+    os_msgq_id_t (*msgq_priority_init)(const void *, u16_t, u16_t, const char_t *);
+    i32p_t (*msgq_priority_put)(os_msgq_id_t, const u8_t *, u16_t, u8_t, b_t, os_timeout_t);
+
+    os_stream_id_t (*stream_init)(void *, u32_t, u32_t, const char_t *);
+    os_stream_id_t (*msgbuf_init)(void *, u32_t, const char_t *);
+    i32p_t (*stream_send)(os_stream_id_t, const u8_t *, u32_t, os_timeout_t);
+    i32p_t (*stream_receive)(os_stream_id_t, u8_t *, u32_t, u32_t *, os_timeout_t);
+    i32p_t (*stream_peek)(os_stream_id_t, const u8_t **, u32_t *);
+    i32p_t (*stream_consume)(os_stream_id_t, u32_t);
 
     os_pool_id_t (*pool_init)(const void *, u16_t, u16_t, const char_t *);
     i32p_t (*pool_take)(os_pool_id_t, void **, u16_t, os_timeout_t);
@@ -810,6 +1808,15 @@ typedef struct {
     b_t (*trace_postcode)(const pTrace_postcodeFunc_t);
     void (*trace_thread)(const pTrace_threadFunc_t);
     void (*trace_time)(const pTrace_analyzeFunc_t);
+    void (*trace_deadline)(const pTrace_deadlineFunc_t);
+    i32p_t (*trace_fpu)(os_fpu_statistics_t *);
+    void (*trace_mutex)(const pTrace_contentionFunc_t);
+    void (*trace_sem)(const pTrace_contentionFunc_t);
+    void (*trace_msgq)(const pTrace_contentionFunc_t);
+    void (*trace_thread_latency)(const pTrace_latencyFunc_t);
+    void (*trace_thread_latency_reset)(void);
+    void (*trace_critical_section)(const pTrace_criticalFunc_t);
+    void (*trace_critical_section_reset)(void);
 } at_rtos_api_t;
 #endif
 
@@ -25,14 +25,54 @@
 #define EVENT_RUNTIME_NUMBER_SUPPORTED (1u)
 #endif
 
+#ifndef EVENT_VALUE_WORD_NUMBER
+#define EVENT_VALUE_WORD_NUMBER (1u)
+#endif
+
 #ifndef MUTEX_RUNTIME_NUMBER_SUPPORTED
 #define MUTEX_RUNTIME_NUMBER_SUPPORTED (1u)
 #endif
 
+#ifndef MUTEX_ADAPTIVE_YIELD_NUMBER
+#define MUTEX_ADAPTIVE_YIELD_NUMBER (2u)
+#endif
+
+#ifndef RWLOCK_RUNTIME_NUMBER_SUPPORTED
+#define RWLOCK_RUNTIME_NUMBER_SUPPORTED (1u)
+#endif
+
+#ifndef COND_RUNTIME_NUMBER_SUPPORTED
+#define COND_RUNTIME_NUMBER_SUPPORTED (1u)
+#endif
+
+#ifndef BARRIER_RUNTIME_NUMBER_SUPPORTED
+#define BARRIER_RUNTIME_NUMBER_SUPPORTED (1u)
+#endif
+
+#ifndef LATCH_RUNTIME_NUMBER_SUPPORTED
+#define LATCH_RUNTIME_NUMBER_SUPPORTED (1u)
+#endif
+
 #ifndef QUEUE_RUNTIME_NUMBER_SUPPORTED
 #define QUEUE_RUNTIME_NUMBER_SUPPORTED (1u)
 #endif
 
+#ifndef QUEUE_PRIORITY_NUMBER
+#define QUEUE_PRIORITY_NUMBER (8u)
+#endif
+
+#if (QUEUE_PRIORITY_NUMBER > 32u)
+#error "The QUEUE_PRIORITY_NUMBER is up to 32"
+#endif
+
+#ifndef STREAM_RUNTIME_NUMBER_SUPPORTED
+#define STREAM_RUNTIME_NUMBER_SUPPORTED (1u)
+#endif
+
+#ifndef COROUTINE_POLL_INTERVAL_MS
+#define COROUTINE_POLL_INTERVAL_MS (10u)
+#endif
+
 #ifndef TIMER_RUNTIME_NUMBER_SUPPORTED
 #define TIMER_RUNTIME_NUMBER_SUPPORTED (1u)
 #endif
@@ -85,6 +125,38 @@
 #define KERNEL_THREAD_STACK_SIZE (1024u)
 #endif
 
+#ifndef THREAD_DEADLINE_ENABLED
+#define THREAD_DEADLINE_ENABLED (DISABLED)
+#endif
+
+#ifndef THREAD_BUDGET_ENABLED
+#define THREAD_BUDGET_ENABLED (DISABLED)
+#endif
+
+#ifndef FPU_LAZY_SWITCH_ENABLED
+#define FPU_LAZY_SWITCH_ENABLED (DISABLED)
+#endif
+
+#ifndef TRACE_SCHEDULE_LATENCY_ENABLED
+#define TRACE_SCHEDULE_LATENCY_ENABLED (DISABLED)
+#endif
+
+#ifndef TRACE_SCHEDULE_LATENCY_BUCKET_NUMBER
+#define TRACE_SCHEDULE_LATENCY_BUCKET_NUMBER (16u)
+#endif
+
+#ifndef TRACE_CRITICAL_SECTION_ENABLED
+#define TRACE_CRITICAL_SECTION_ENABLED (DISABLED)
+#endif
+
+#ifndef TRACE_CRITICAL_SECTION_BUCKET_NUMBER
+#define TRACE_CRITICAL_SECTION_BUCKET_NUMBER (16u)
+#endif
+
+#ifndef TRACE_CONTENTION_ENABLED
+#define TRACE_CONTENTION_ENABLED (DISABLED)
+#endif
+
 /* It defined the AtOS extern symbol for convenience use, but it has extra memory consumption */
 #ifndef OS_API_ENABLE
 #define OS_API_ENABLE (ENABLED)
@@ -115,6 +187,12 @@
  * There is no default setting, which must be set in the atos_configuration.h file.
  */
 
+#if (FPU_LAZY_SWITCH_ENABLED)
+#if !defined(ARCH_NATIVE_GCC) && !(defined(__ARMCC_VERSION) && (__ARMCC_VERSION >= 6010050))
+#error "The lazy FPU context switch is supported by the Keil AC6 and the native GCC ports only, the others have no FPU context save and restore"
+#endif
+#endif
+
 #if !defined __CC_ARM && !defined(__ARMCC_VERSION) && (__ARMCC_VERSION >= 6010050) && !defined __ICCARM__ && !defined __GUNC__ &&          \
     !defined __TMS470__ && !defined __TASKING__ && !defined ARCH_NATIVE_GCC
 
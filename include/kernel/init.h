@@ -22,6 +22,11 @@
 #define INIT_SECTION_OS_POOL_LIST  _INIT_OS_POOL_LIST
 #define INIT_SECTION_OS_PUBLISH_LIST _INIT_OS_PUBLISH_LIST
 #define INIT_SECTION_OS_SUBSCRIBE_LIST  _INIT_OS_SUBSCRIBE_LIST
+#define INIT_SECTION_OS_RWLOCK_LIST _INIT_OS_RWLOCK_LIST
+#define INIT_SECTION_OS_COND_LIST _INIT_OS_COND_LIST
+#define INIT_SECTION_OS_BARRIER_LIST _INIT_OS_BARRIER_LIST
+#define INIT_SECTION_OS_LATCH_LIST _INIT_OS_LATCH_LIST
+#define INIT_SECTION_OS_STREAM_LIST _INIT_OS_STREAM_LIST
 #elif defined(__ICCARM__)
 #define INIT_SECTION_FUNC "_INIT_FUNC_LIST"
 #pragma section = INIT_SECTION_FUNC
@@ -55,6 +60,21 @@
 #define INIT_SECTION_OS_SUBSCRIBE_LIST  "_INIT_OS_SUBSCRIBE_LIST"
 #pragma section = INIT_SECTION_OS_SUBSCRIBE_LIST
 
+#define INIT_SECTION_OS_RWLOCK_LIST "_INIT_OS_RWLOCK_LIST"
+#pragma section = INIT_SECTION_OS_RWLOCK_LIST
+
+#define INIT_SECTION_OS_COND_LIST "_INIT_OS_COND_LIST"
+#pragma section = INIT_SECTION_OS_COND_LIST
+
+#define INIT_SECTION_OS_BARRIER_LIST "_INIT_OS_BARRIER_LIST"
+#pragma section = INIT_SECTION_OS_BARRIER_LIST
+
+#define INIT_SECTION_OS_LATCH_LIST "_INIT_OS_LATCH_LIST"
+#pragma section = INIT_SECTION_OS_LATCH_LIST
+
+#define INIT_SECTION_OS_STREAM_LIST "_INIT_OS_STREAM_LIST"
+#pragma section = INIT_SECTION_OS_STREAM_LIST
+
 #elif defined(__GNUC__)
 #error "not supported __GNUC__ compiler"
 #else
@@ -80,7 +100,7 @@
          .pStackAddr = id_name##_stack,                                                                                                    \
          .stackSize = stack_size,                                                                                                          \
          .pEntryFunc = pEntryFn,                                                                                                           \
-         .task = {.prior = priority, .psp = 0u}};                                                                                          \
+         .task = {.prior = priority, .base_prior = priority, .psp = 0u}};                                                                  \
     INIT_USED thread_context_init_t _init_##id_name##_thread_init INIT_SECTION(_INIT_OS_THREAD_STATIC) =                                   \
         {.pThread = &_init_##id_name##_thread};                                                                                            \
     os_thread_id_t id_name = {.p_val = (void*)&_init_##id_name##_thread, .pName = #id_name}
@@ -114,20 +134,20 @@ extern void timer_callback_fromTimeOut(void *pNode);
         {.head = {.cs = CS_INITED, .pName = #id_name},                                                                                     \
          .locked = false,                                                                                                                  \
          .pHoldTask = NULL,                                                                                                                \
-         .originalPriority = OS_PRIOTITY_INVALID_LEVEL};                                                                                   \
+         .held_node = {NULL}};                                                                                                             \
     os_mutex_id_t id_name = {.p_val = (void*)&_init_##id_name##_mutex, .pName = #id_name}
 
 #define INIT_OS_EVT_RUNTIME_NUM_DEFINE(num)                                                                                                \
     INIT_USED event_context_t _init_runtime_evt[num] INIT_SECTION(_INIT_OS_EVENT_LIST) = {0}
 
-#define INIT_OS_EVT_DEFINE(id_name, anyMask, modeMask, dirMask, init)                                                                      \
+#define INIT_OS_EVT_DEFINE(id_name, any, mode, dir, init)                                                                                  \
     INIT_USED event_context_t _init_##id_name##_evt INIT_SECTION(_INIT_OS_EVENT_LIST) =                                                    \
         {.head = {.cs = CS_INITED, .pName = #id_name},                                                                                     \
-         .value = init,                                                                                                                    \
-         .triggered = 0u,                                                                                                                  \
-         .anyMask = anyMask,                                                                                                               \
-         .modeMask = modeMask,                                                                                                             \
-         .dirMask = dirMask};                                                                                                              \
+         .value = {init},                                                                                                                  \
+         .triggered = {0u},                                                                                                                \
+         .anyMask = {any},                                                                                                                 \
+         .modeMask = {mode},                                                                                                               \
+         .dirMask = {dir}};                                                                                                                \
     os_evt_id_t id_name = {.p_val = (void*)&_init_##id_name##_evt, .pName = #id_name}
 
 #define INIT_OS_MSGQ_RUNTIME_NUM_DEFINE(num)                                                                                               \
@@ -176,6 +196,56 @@ extern void subscribe_notification(void *pLinker);
         {.head = {.cs = CS_INITED, .pName = #id_name}};                                                                                    \
     os_publish_id_t id_name = {.p_val = (void*)&_init_##id_name##_publish, .pName = #id_name}
 
+#define INIT_OS_RWLOCK_RUNTIME_NUM_DEFINE(num)                                                                                             \
+    INIT_USED rwlock_context_t _init_runtime_rwlock[num] INIT_SECTION(_INIT_OS_RWLOCK_LIST) = {0}
+
+#define INIT_OS_RWLOCK_DEFINE(id_name)                                                                                                     \
+    INIT_USED rwlock_context_t _init_##id_name##_rwlock INIT_SECTION(_INIT_OS_RWLOCK_LIST) =                                               \
+        {.head = {.cs = CS_INITED, .pName = #id_name},                                                                                     \
+         .readers = 0u,                                                                                                                    \
+         .pWriteTask = NULL};                                                                                                              \
+    os_rwlock_id_t id_name = {.p_val = (void*)&_init_##id_name##_rwlock, .pName = #id_name}
+
+#define INIT_OS_COND_RUNTIME_NUM_DEFINE(num)                                                                                               \
+    INIT_USED cond_context_t _init_runtime_cond[num] INIT_SECTION(_INIT_OS_COND_LIST) = {0}
+
+#define INIT_OS_COND_DEFINE(id_name)                                                                                                       \
+    INIT_USED cond_context_t _init_##id_name##_cond INIT_SECTION(_INIT_OS_COND_LIST) = {.head = {.cs = CS_INITED, .pName = #id_name}};     \
+    os_cond_id_t id_name = {.p_val = (void*)&_init_##id_name##_cond, .pName = #id_name}
+
+#define INIT_OS_BARRIER_RUNTIME_NUM_DEFINE(num)                                                                                            \
+    INIT_USED barrier_context_t _init_runtime_barrier[num] INIT_SECTION(_INIT_OS_BARRIER_LIST) = {0}
+
+#define INIT_OS_BARRIER_DEFINE(id_name, number)                                                                                            \
+    INIT_USED barrier_context_t _init_##id_name##_barrier INIT_SECTION(_INIT_OS_BARRIER_LIST) =                                            \
+        {.head = {.cs = CS_INITED, .pName = #id_name},                                                                                     \
+         .parties = number,                                                                                                                \
+         .remains = number};                                                                                                               \
+    os_barrier_id_t id_name = {.p_val = (void*)&_init_##id_name##_barrier, .pName = #id_name}
+
+#define INIT_OS_LATCH_RUNTIME_NUM_DEFINE(num)                                                                                              \
+    INIT_USED latch_context_t _init_runtime_latch[num] INIT_SECTION(_INIT_OS_LATCH_LIST) = {0}
+
+#define INIT_OS_LATCH_DEFINE(id_name, number)                                                                                              \
+    INIT_USED latch_context_t _init_##id_name##_latch INIT_SECTION(_INIT_OS_LATCH_LIST) =                                                  \
+        {.head = {.cs = CS_INITED, .pName = #id_name},                                                                                     \
+         .count = number};                                                                                                                 \
+    os_latch_id_t id_name = {.p_val = (void*)&_init_##id_name##_latch, .pName = #id_name}
+
+#define INIT_OS_STREAM_RUNTIME_NUM_DEFINE(num)                                                                                             \
+    INIT_USED stream_context_t _init_runtime_stream[num] INIT_SECTION(_INIT_OS_STREAM_LIST) = {0}
+
+#define INIT_OS_STREAM_DEFINE(id_name, pBufAddr, size, trigger, isMessage)                                                                 \
+    INIT_USED stream_context_t _init_##id_name##_stream INIT_SECTION(_INIT_OS_STREAM_LIST) =                                               \
+        {.head = {.cs = CS_INITED, .pName = #id_name},                                                                                     \
+         .pBufferAddress = pBufAddr,                                                                                                       \
+         .bufferSize = size,                                                                                                               \
+         .readPosition = 0u,                                                                                                               \
+         .cacheSize = 0u,                                                                                                                  \
+         .triggerLevel = ((trigger) > (size)) ? (size) : (trigger),                                                                        \
+         .message = isMessage};                                                                                                            \
+    os_stream_id_t id_name = {.p_val = (void*)&_init_##id_name##_stream, .pName = #id_name}
+
 #elif defined(__ICCARM__)
 #pragma diag_suppress = Pm086
 #define INIT_SECTION(name)       @name
@@ -195,7 +265,7 @@ extern void subscribe_notification(void *pLinker);
          .pStackAddr = id_name##_stack,                                                                                                    \
          .stackSize = stack_size,                                                                                                          \
          .pEntryFunc = pEntryFn,                                                                                                           \
-         .task = {.prior = priority, .psp = 0u}};                                                                                          \
+         .task = {.prior = priority, .base_prior = priority, .psp = 0u}};                                                                  \
     static __root thread_context_init_t _init_##id_name##_thread_init @ "_INIT_OS_THREAD_STATIC" =                                         \
         {.pThread = &_init_##id_name##_thread};                                                                                            \
     os_thread_id_t id_name = {.p_val = (void*)&_init_##id_name##_thread, .pName = #id_name}
@@ -229,20 +299,20 @@ extern void timer_callback_fromTimeOut(void *pNode);
         {.head = {.cs = CS_INITED, .pName = #id_name},                                                                                     \
          .locked = false,                                                                                                                  \
          .pHoldTask = NULL,                                                                                                                \
-         .originalPriority = OS_PRIOTITY_INVALID_LEVEL};                                                                                   \
+         .held_node = {NULL}};                                                                                                             \
     os_mutex_id_t id_name = {.p_val = (void*)&_init_##id_name##_mutex, .pName = #id_name}
 
 #define INIT_OS_EVT_RUNTIME_NUM_DEFINE(num)                                                                                                \
     static __root event_context_t _init_runtime_evt[num] @ "_INIT_OS_EVENT_LIST" = {0}
 
-#define INIT_OS_EVT_DEFINE(id_name, anyMask, modeMask, dirMask, init)                                                                      \
+#define INIT_OS_EVT_DEFINE(id_name, any, mode, dir, init)                                                                                  \
     static __root event_context_t _init_##id_name##_evt @ "_INIT_OS_EVENT_LIST" =                                                          \
         {.head = {.cs = CS_INITED, .pName = #id_name},                                                                                     \
-         .value = init,                                                                                                                    \
-         .triggered = 0u,                                                                                                                  \
-         .anyMask = anyMask,                                                                                                               \
-         .modeMask = modeMask,                                                                                                             \
-         .dirMask = dirMask};                                                                                                              \
+         .value = {init},                                                                                                                  \
+         .triggered = {0u},                                                                                                                \
+         .anyMask = {any},                                                                                                                 \
+         .modeMask = {mode},                                                                                                               \
+         .dirMask = {dir}};                                                                                                                \
     os_evt_id_t id_name = {.p_val = (void*)&_init_##id_name##_evt, .pName = #id_name}
 
 #define INIT_OS_MSGQ_RUNTIME_NUM_DEFINE(num)                                                                                               \
@@ -291,6 +361,56 @@ extern void timer_callback_fromTimeOut(void *pNode);
         {.head = {.cs = CS_INITED, .pName = #id_name}};                                                                                    \
     os_publish_id_t id_name = {.p_val = (void*)&_init_##id_name##_publish, .pName = #id_name}
 
+#define INIT_OS_RWLOCK_RUNTIME_NUM_DEFINE(num)                                                                                             \
+    static __root rwlock_context_t _init_runtime_rwlock[num] @ "_INIT_OS_RWLOCK_LIST" = {0}
+
+#define INIT_OS_RWLOCK_DEFINE(id_name)                                                                                                     \
+    static __root rwlock_context_t _init_##id_name##_rwlock @ "_INIT_OS_RWLOCK_LIST" =                                                     \
+        {.head = {.cs = CS_INITED, .pName = #id_name},                                                                                     \
+         .readers = 0u,                                                                                                                    \
+         .pWriteTask = NULL};                                                                                                              \
+    os_rwlock_id_t id_name = {.p_val = (void*)&_init_##id_name##_rwlock, .pName = #id_name}
+
+#define INIT_OS_COND_RUNTIME_NUM_DEFINE(num)                                                                                               \
+    static __root cond_context_t _init_runtime_cond[num] @ "_INIT_OS_COND_LIST" = {0}
+
+#define INIT_OS_COND_DEFINE(id_name)                                                                                                       \
+    static __root cond_context_t _init_##id_name##_cond @ "_INIT_OS_COND_LIST" = {.head = {.cs = CS_INITED, .pName = #id_name}};           \
+    os_cond_id_t id_name = {.p_val = (void*)&_init_##id_name##_cond, .pName = #id_name}
+
+#define INIT_OS_BARRIER_RUNTIME_NUM_DEFINE(num)                                                                                            \
+    static __root barrier_context_t _init_runtime_barrier[num] @ "_INIT_OS_BARRIER_LIST" = {0}
+
+#define INIT_OS_BARRIER_DEFINE(id_name, number)                                                                                            \
+    static __root barrier_context_t _init_##id_name##_barrier @ "_INIT_OS_BARRIER_LIST" =                                                  \
+        {.head = {.cs = CS_INITED, .pName = #id_name},                                                                                     \
+         .parties = number,                                                                                                                \
+         .remains = number};                                                                                                               \
+    os_barrier_id_t id_name = {.p_val = (void*)&_init_##id_name##_barrier, .pName = #id_name}
+
+#define INIT_OS_LATCH_RUNTIME_NUM_DEFINE(num)                                                                                              \
+    static __root latch_context_t _init_runtime_latch[num] @ "_INIT_OS_LATCH_LIST" = {0}
+
+#define INIT_OS_LATCH_DEFINE(id_name, number)                                                                                              \
+    static __root latch_context_t _init_##id_name##_latch @ "_INIT_OS_LATCH_LIST" =                                                        \
+        {.head = {.cs = CS_INITED, .pName = #id_name},                                                                                     \
+         .count = number};                                                                                                                 \
+    os_latch_id_t id_name = {.p_val = (void*)&_init_##id_name##_latch, .pName = #id_name}
+
+#define INIT_OS_STREAM_RUNTIME_NUM_DEFINE(num)                                                                                             \
+    static __root stream_context_t _init_runtime_stream[num] @ "_INIT_OS_STREAM_LIST" = {0}
+
+#define INIT_OS_STREAM_DEFINE(id_name, pBufAddr, size, trigger, isMessage)                                                                 \
+    static __root stream_context_t _init_##id_name##_stream @ "_INIT_OS_STREAM_LIST" =                                                     \
+        {.head = {.cs = CS_INITED, .pName = #id_name},                                                                                     \
+         .pBufferAddress = pBufAddr,                                                                                                       \
+         .bufferSize = size,                                                                                                               \
+         .readPosition = 0u,                                                                                                               \
+         .cacheSize = 0u,                                                                                                                  \
+         .triggerLevel = ((trigger) > (size)) ? (size) : (trigger),                                                                        \
+         .message = isMessage};                                                                                                            \
+    os_stream_id_t id_name = {.p_val = (void*)&_init_##id_name##_stream, .pName = #id_name}
+
 #pragma diag_default = Pm086
 #elif defined(__GNUC__)
 #error "not supported __GNUC__ compiler"
@@ -344,14 +464,42 @@ enum {
     INIT_LEVEL_NUM,
 };
 
+enum {
+    INIT_SLOT_THREAD,
+    INIT_SLOT_TIMER,
+    INIT_SLOT_SEMAPHORE,
+    INIT_SLOT_MUTEX,
+    INIT_SLOT_EVENT,
+    INIT_SLOT_QUEUE,
+    INIT_SLOT_POOL,
+    INIT_SLOT_PUBLISH,
+    INIT_SLOT_SUBSCRIBE,
+    INIT_SLOT_RWLOCK,
+    INIT_SLOT_COND,
+    INIT_SLOT_BARRIER,
+    INIT_SLOT_LATCH,
+    INIT_SLOT_STREAM,
+    INIT_SLOT_NUM,
+};
+
 typedef void (*init_func)(void);
 typedef struct {
     init_func func;
     u8_t level;
 } init_func_t;
 
+typedef struct {
+    /* The free slot list of the object section */
+    list_t free_list;
+
+    /* The free slot list was built */
+    b_t built;
+} init_slot_t;
+
 void init_func_list(void);
 void init_func_level(u8_t level);
 void init_static_thread_list(void);
+void *init_slot_take(u8_t type);
+void init_slot_release(u8_t type, struct base_head *pHead);
 
 #endif
@@ -11,6 +11,7 @@
 #include "arch.h"
 #include "ktype.h"
 #include "port.h"
+#include "trace.h"
 
 #ifndef KERNEL_THREAD_STACK_SIZE
 #define KERNEL_SCHEDULE_THREAD_STACK_SIZE (1024u)
@@ -24,17 +25,41 @@
 #define KERNEL_IDLE_THREAD_STACK_SIZE (IDLE_THREAD_STACK_SIZE)
 #endif
 
+#if (TRACE_CRITICAL_SECTION_ENABLED)
+#define ENTER_CRITICAL_SECTION()                                                                                                           \
+    ARCH_ENTER_CRITICAL_SECTION();                                                                                                         \
+    static critical_site_t _critical_site = {.pFile = __FILE__, .line = __LINE__};                                                        \
+    u32_t _critical_start = port_cycle_count_get()
+
+#define EXIT_CRITICAL_SECTION()                                                                                                            \
+    trace_critical_section_record(&_critical_site, _critical_start);                                                                       \
+    ARCH_EXIT_CRITICAL_SECTION()
+#else
 #define ENTER_CRITICAL_SECTION() ARCH_ENTER_CRITICAL_SECTION()
 #define EXIT_CRITICAL_SECTION()  ARCH_EXIT_CRITICAL_SECTION()
+#endif
 
 thread_context_t *kernel_thread_runContextGet(void);
 list_t *kernel_member_list_get(u8_t member_id, u8_t list_id);
 void kernel_thread_list_transfer_toEntry(linker_head_t *pCurHead);
-i32p_t schedule_exit_trigger(struct schedule_task *pTask, void *pHoldCtx, void *pHoldData, list_t *pToList, u32_t timeout_ms,
-                             b_t immediately);
-i32p_t schedule_entry_trigger(struct schedule_task *pTask, pTask_callbackFunc_t callback, u32_t result);
+i32p_t schedule_exit_trigger(struct schedule_task *pTask, void *pHoldCtx, void *pHoldData, list_t *pToList, u32_t timeout_ms);
+i32p_t schedule_entry_trigger(struct schedule_task *pTask, u32_t result);
+i32p_t schedule_entry_all_trigger(list_t *pList, u32_t result);
+void schedule_pend_timeout_set(struct schedule_task *pTask, pTimeout_callbackFunc_t pFunc);
 void schedule_callback_fromTimeOut(void *pNode);
+#if (THREAD_BUDGET_ENABLED)
+void schedule_callback_fromBudget(void *pNode);
+#endif
 void schedule_setPend(struct schedule_task *pTask);
+void schedule_priority_update(struct schedule_task *pTask, i16_t priority);
+i16_t schedule_priority_base(struct schedule_task *pTask);
+#if (THREAD_BUDGET_ENABLED)
+void schedule_budget_set(struct schedule_task *pTask, u32_t budget_us, u32_t period_ms);
+void mutex_priority_recalculate(struct schedule_task *pTask);
+#endif
+b_t schedule_yield_to(struct schedule_task *pTask, struct schedule_task *pTarget);
+void coroutine_object_subscribe(struct coroutine_context *pCo, struct coroutine_group **ppSubscriber);
+void coroutine_object_post(struct coroutine_group **ppSubscriber);
 list_t *schedule_waitList(void);
 b_t schedule_hasTwoPendingItem(void);
 i32p_t kernel_schedule_result_take(void);
@@ -43,6 +68,7 @@ b_t kernel_isInThreadMode(void);
 i32p_t kernel_thread_schedule_request(void);
 void kernel_message_notification(void);
 void kernel_scheduler_inPendSV_c(u32_t **ppCurPsp, u32_t **ppNextPSP);
+void kernel_fpu_trap_handler(void);
 void kernel_privilege_call_inSVC_c(u32_t *svc_args);
 i32p_t kernel_privilege_invoke(const void *pCallFun, arguments_t *pArgs);
 void kernel_schedule_thread(void);
@@ -24,7 +24,6 @@
 
 typedef void (*pCallbackFunc_t)(void);
 typedef void (*pTimer_callbackFunc_t)(void);
-typedef void (*pTask_callbackFunc_t)(void *);
 typedef void (*pThread_entryFunc_t)(void);
 typedef void (*pEvent_callbackFunc_t)(void);
 typedef void (*pSubscribe_callbackFunc_t)(const void *, u16_t);
@@ -34,7 +33,13 @@ typedef void (*pNotify_callbackFunc_t)(void *);
 struct base_head {
     u8_t cs; // control and status
 
-    const char_t *pName;
+    union {
+        /* The object name, it's valid when the cs is inited */
+        const char_t *pName;
+
+        /* The free slot node, it's valid when the cs is zero */
+        list_node_t free;
+    };
 };
 
 struct publish_context {
@@ -81,9 +86,20 @@ struct expired_time {
 
     u64_t duration_us;
 
+    /* The tolerance after the deadline, the clock interrupt can be shared with the later timeout within it */
+    u32_t slack_us;
+
     pTimeout_callbackFunc_t fn;
 };
 
+struct timer_statistics {
+    /* The clock interrupts handled by the timeout handler */
+    u32_t interrupts;
+
+    /* The clock interrupts saved by the deadlines coalescing */
+    u32_t coalesced;
+};
+
 struct timer_callback {
     list_node_t node;
 
@@ -97,11 +113,33 @@ typedef struct {
 
     u32_t timeout_ms;
 
+    /* The missed periods of the cycle timer */
+    u32_t overrun;
+
     struct expired_time expire;
 
     struct timer_callback call;
 } timer_context_t;
 
+struct contention_statistics {
+    /* The acquisitions that took the object */
+    u32_t acquired;
+
+    /* The acquisitions that blocked in the waiting list */
+    u32_t contended;
+
+    /* The blocking time of the contended acquisitions */
+    u64_t total_wait_us;
+
+    u32_t max_wait_us;
+
+    /* The longest waiting list */
+    u16_t max_waiters;
+
+    /* The highest used depth, it's the taken count of the semaphore and the cached messages of the queue */
+    u16_t max_depth;
+};
+
 typedef struct {
     struct base_head head;
 
@@ -111,9 +149,27 @@ typedef struct {
 
     u32_t timeout_ms;
 
+#if (TRACE_CONTENTION_ENABLED)
+    struct contention_statistics contention;
+#endif
+
+    /* The coroutine group that polled it without success, the next post wakes its host thread up */
+    struct coroutine_group *pCoGroup;
+
     list_t q_list;
 } semaphore_context_t;
 
+struct mutex_statistics {
+    /* The contended locks that yielded to the ready hold task */
+    u32_t yields;
+
+    /* The yielded locks that acquired the mutex without blocking */
+    u32_t yield_acquired;
+
+    /* The contended locks that blocked in the waiting list */
+    u32_t blocked;
+};
+
 typedef struct {
     struct base_head head;
 
@@ -121,17 +177,83 @@ typedef struct {
 
     struct schedule_task *pHoldTask;
 
-    i16_t originalPriority;
+    /* The hold task can lock it again when it's recursive */
+    b_t recursive;
+
+    /* The nesting lock count of the recursive mutex */
+    u16_t nesting;
+
+    /* The contended lock yields to the ready hold task of the same priority before it's blocked */
+    b_t adaptive;
+
+    struct mutex_statistics statistics;
+
+#if (TRACE_CONTENTION_ENABLED)
+    struct contention_statistics contention;
+#endif
+
+    /* The node in the held list of the hold task */
+    list_node_t held_node;
 
     list_t q_list;
 } mutex_context_t;
 
+typedef struct {
+    struct base_head head;
+
+    /* The waiting list of the condition, the waiter keeps its mutex in the pend data */
+    list_t q_list;
+} cond_context_t;
+
+typedef struct {
+    struct base_head head;
+
+    /* The thread number that must arrive to release the barrier */
+    u16_t parties;
+
+    /* The thread number that hasn't arrived in the current round */
+    u16_t remains;
+
+    list_t q_list;
+} barrier_context_t;
+
+typedef struct {
+    struct base_head head;
+
+    /* The remaining count down number to release the waiters */
+    u32_t count;
+
+    list_t q_list;
+} latch_context_t;
+
+typedef struct {
+    struct base_head head;
+
+    /* The number of the tasks holding the read lock */
+    u16_t readers;
+
+    /* The task holding the write lock */
+    struct schedule_task *pWriteTask;
+
+    /* The waiting list of the read lock */
+    list_t r_list;
+
+    /* The waiting list of the write lock */
+    list_t w_list;
+} rwlock_context_t;
+
 typedef struct {
     const u8_t *pUsrBuf;
     u16_t size;
     b_t reverse;
+
+    /* The message priority of the priority queue */
+    u8_t priority;
 } queue_sch_t;
 
+/* The slot of the priority queue is the next slot index followed by the element */
+#define QUEUE_PRIORITY_SLOT_SIZE(len) ((((len) + 1u) & ~1u) + sizeof(u16_t))
+
 typedef struct {
     struct base_head head;
 
@@ -147,11 +269,60 @@ typedef struct {
 
     u16_t cacheSize;
 
+    /* The message is dequeued by its priority, each priority level is a FIFO of the linked slots */
+    b_t priority;
+
+    u16_t freeSlot;
+
+    u16_t priorityHead[QUEUE_PRIORITY_NUMBER];
+
+    u16_t priorityTail[QUEUE_PRIORITY_NUMBER];
+
+    /* The bit map of the non-empty priority levels */
+    u32_t priorityBits;
+
+#if (TRACE_CONTENTION_ENABLED)
+    struct contention_statistics contention;
+#endif
+
+    /* The coroutine group that polled it without success, the next post wakes its host thread up */
+    struct coroutine_group *pCoGroup;
+
     list_t in_QList;
 
     list_t out_QList;
 } queue_context_t;
 
+typedef struct {
+    const u8_t *pUsrBuf;
+    u32_t size;
+
+    /* The byte number that was copied for the blocked thread */
+    u32_t done;
+} stream_sch_t;
+
+typedef struct {
+    struct base_head head;
+
+    u8_t *pBufferAddress;
+
+    u32_t bufferSize;
+
+    u32_t readPosition;
+
+    u32_t cacheSize;
+
+    /* The cached byte number that wakes up the blocked reader of the stream */
+    u32_t triggerLevel;
+
+    /* Each message is stored with its length prefix and is never split */
+    b_t message;
+
+    list_t in_QList;
+
+    list_t out_QList;
+} stream_context_t;
+
 typedef struct {
     struct base_head head;
 
@@ -168,9 +339,16 @@ typedef struct {
 
 typedef struct {
     /* The listen bits*/
-    u32_t listen;
+    u32_t listen[EVENT_VALUE_WORD_NUMBER];
+
+    /* The word number of the listen bits */
+    u8_t words;
+
+    /* The pointer of the waiter value words */
+    u32_t *pValue;
 
-    struct evt_val *pEvtVal;
+    /* The pointer of the waiter trigger words */
+    u32_t *pTrigger;
 } event_sch_t;
 
 struct event_callback {
@@ -183,36 +361,39 @@ typedef struct {
     struct base_head head;
 
     /* The event signal value */
-    u32_t value;
+    u32_t value[EVENT_VALUE_WORD_NUMBER];
 
     /* Changed bits always trigger = 1, See dirMask below = 0. */
-    u32_t anyMask;
+    u32_t anyMask[EVENT_VALUE_WORD_NUMBER];
 
     /* Level trigger = 0, Edge trigger = 1. */
-    u32_t modeMask;
+    u32_t modeMask[EVENT_VALUE_WORD_NUMBER];
 
     /* Fall or Low trigger = 0, Rise or high trigger = 1. */
-    u32_t dirMask;
+    u32_t dirMask[EVENT_VALUE_WORD_NUMBER];
 
     /* The triggered value */
-    u32_t triggered;
+    u32_t triggered[EVENT_VALUE_WORD_NUMBER];
 
     /* When the event change that meet with edge setting, the function will be called */
     struct event_callback call;
 
+    /* The coroutine group that polled it without success, the next post wakes its host thread up */
+    struct coroutine_group *pCoGroup;
+
     list_t q_list;
 } event_context_t;
 
-struct call_exit {
-    list_t *pToList;
-
-    u32_t timeout_ms;
-};
-
 struct call_entry {
     i32p_t result;
 
-    pTask_callbackFunc_t fun;
+#if (TRACE_CONTENTION_ENABLED)
+    /* The system time when the task is blocked */
+    u32_t block_us;
+
+    /* The blocking time until the task is woken up */
+    u32_t wait_us;
+#endif
 };
 
 struct call_analyze {
@@ -225,14 +406,107 @@ struct call_analyze {
     u32_t total_run_ms;
 };
 
-struct call_exec {
-    union {
-        struct call_exit exit;
+struct call_latency {
+    /* The system time when the task is woken up */
+    u32_t wake_us;
 
-        struct call_entry entry;
-    };
+    /* The task is woken up and it doesn't run yet */
+    b_t pending;
+
+    u32_t count;
+
+    u32_t min_us;
+
+    u32_t max_us;
+
+    /* The log2 buckets of the wake-to-run latency, the bucket n counts [2^n, 2^(n+1)) us and the last one takes the rest */
+    u32_t histogram[TRACE_SCHEDULE_LATENCY_BUCKET_NUMBER];
+};
+
+struct call_exec {
+    struct call_entry entry;
 
     struct call_analyze analyze;
+
+#if (TRACE_SCHEDULE_LATENCY_ENABLED)
+    struct call_latency latency;
+#endif
+};
+
+struct schedule_edf {
+    /* The task is ordered by its absolute deadline among the tasks of the same priority */
+    b_t enabled;
+
+    u32_t period_ms;
+
+    /* The relative deadline of each job */
+    u32_t deadline_ms;
+
+    /* The release time of the current job */
+    u32_t release_ms;
+
+    /* The absolute deadline of the current job */
+    u32_t abs_deadline_ms;
+
+    /* The completed jobs */
+    u32_t jobs;
+
+    /* The jobs that completed after their absolute deadline */
+    u32_t misses;
+};
+
+struct schedule_budget {
+    /* The task execution time is limited by the budget in each period */
+    b_t enabled;
+
+    /* The task runs at the lowest application priority until the budget is replenished, the mutex inheritance still applies */
+    b_t throttled;
+
+    /* The budget timer expired while the task was running */
+    b_t exhausted;
+
+    u32_t budget_us;
+
+    u32_t period_ms;
+
+    u32_t remaining_us;
+
+    /* The next replenishment time */
+    u32_t replenish_ms;
+
+    /* The system time when the task started to be charged */
+    u32_t dispatch_us;
+
+    /* The throttled times */
+    u32_t throttles;
+
+    /* It's armed with the remaining budget when the task is charged, and with the replenishment when it's throttled */
+    struct expired_time expire;
+};
+
+struct schedule_fpu {
+    /* The task executed the floating point instructions */
+    b_t used;
+
+    /* The times that the task trapped to take the FPU ownership */
+    u32_t traps;
+
+    /* The {S0 - S31, FPSCR} saved while the other task owns the FPU */
+    u32_t regs[33];
+};
+
+struct fpu_statistics {
+    /* The context switches */
+    u32_t switches;
+
+    /* The switches out of the task that used the FPU, the eager switch saves the FPU context on each of them */
+    u32_t deferred;
+
+    /* The FPU context saves done when the ownership changed */
+    u32_t saves;
+
+    /* The owner switched back in with its context still in the FPU registers, the eager switch saves and restores it */
+    u32_t avoided;
 };
 
 struct schedule_task {
@@ -242,10 +516,31 @@ struct schedule_task {
 
     i16_t prior;
 
+    /* The priority without the mutex inheritance and the budget throttling */
+    i16_t base_prior;
+
+    /* The mutexes held by the task */
+    list_t held_list;
+
+#if (THREAD_DEADLINE_ENABLED)
+    struct schedule_edf edf;
+#endif
+
+#if (THREAD_BUDGET_ENABLED)
+    struct schedule_budget budget;
+#endif
+
+#if (FPU_LAZY_SWITCH_ENABLED)
+    struct schedule_fpu fpu;
+#endif
+
     void *pPendCtx;
 
     void *pPendData;
 
+    /* The pending object drops the task from its state when the task times out, it's called with the pending context */
+    pTimeout_callbackFunc_t pPendTimeoutFunc;
+
     struct call_exec exec;
 
     struct expired_time expire;
@@ -268,6 +563,87 @@ typedef struct {
     struct thread_context *pThread;
 } thread_context_init_t;
 
+struct coroutine_context;
+typedef u8_t (*pCoroutine_entryFunc_t)(struct coroutine_context *);
+
+struct coroutine_context {
+    /* The next coroutine in the same group */
+    struct coroutine_context *pNext;
+
+    pCoroutine_entryFunc_t pEntryFunc;
+
+    void *pArg;
+
+    const char_t *pName;
+
+    /* The continuation where the coroutine resumes, the value 0 starts it from the beginning */
+    u16_t lc;
+
+    /* The coroutine sleeps until the wake time */
+    b_t sleep;
+
+    u32_t wake_ms;
+
+    /* The group that runs the coroutine */
+    struct coroutine_group *pGroup;
+
+    /* The kernel object that it waits wakes the group up, it's not polled */
+    b_t subscribed;
+};
+
+struct coroutine_group {
+    /* The coroutines run in the host thread one by one */
+    struct coroutine_context *pHead;
+
+    /* The host thread task, it waits in the kernel when no coroutine can make progress */
+    struct schedule_task *pTask;
+
+    /* The notification arrived while the host thread was running the coroutines */
+    b_t notified;
+};
+
+typedef void (*pRtc_handlerFunc_t)(void *, u32_t);
+
+struct rtc_task {
+    /* The next task in the same level */
+    struct rtc_task *pNext;
+
+    /* The level that the task runs in */
+    struct rtc_level *pLevel;
+
+    pRtc_handlerFunc_t pHandlerFunc;
+
+    void *pArg;
+
+    const char_t *pName;
+
+    /* The posted events ring */
+    u32_t *pEvents;
+
+    u16_t depth;
+
+    u16_t head;
+
+    u16_t count;
+
+    /* The events that were handled */
+    u32_t dispatched;
+
+    /* The events that were dropped since the ring was full */
+    u32_t dropped;
+};
+
+struct rtc_level {
+    /* The tasks share the stack of the level host thread, each event is handled to completion by a function call */
+    struct rtc_task *pHead;
+
+    /* The host thread task, it waits in the kernel when no event is posted */
+    struct schedule_task *pTask;
+
+    /* The event was posted while the host thread was handling */
+    b_t notified;
+};
+
 /** @brief The rtos kernel structure. */
 typedef struct {
     struct schedule_task *pTask;
@@ -10,6 +10,7 @@
 
 #include "type_def.h"
 #include "linker.h"
+#include "configuration.h"
 
 #define CS_INITED                              (1u)
 #define STACK_STATIC_VALUE_DEFINE(stack, size) u32_t stack[((u32_t)(size) / sizeof(u32_t))] = {0};
@@ -66,6 +67,11 @@ struct evt_val {
     u32_t trigger;
 };
 
+struct evt_wide_val {
+    u32_t value[EVENT_VALUE_WORD_NUMBER];
+    u32_t trigger[EVENT_VALUE_WORD_NUMBER];
+};
+
 /* End of section using anonymous unions */
 #if defined(__CC_ARM)
 #pragma pop
@@ -20,6 +20,11 @@ enum {
     PC_OS_CMPT_TIMER_8,
     PC_OS_CMPT_POOL_9,
     PC_OS_CMPT_PUBLISH_10,
+    PC_OS_CMPT_RWLOCK_11,
+    PC_OS_CMPT_BARRIER_12,
+    PC_OS_CMPT_STREAM_13,
+    PC_OS_CMPT_COROUTINE_14,
+    PC_OS_CMPT_RTC_15,
 
     PC_OS_COMPONENT_NUMBER,
 };
@@ -10,15 +10,80 @@
 #include "type_def.h"
 #include "linker.h"
 #include "kstruct.h"
+#include "configuration.h"
+
+/**
+ * Data structure for the critical section profile, one per ENTER_CRITICAL_SECTION call site.
+ */
+typedef struct critical_site {
+    /* The next profiled call site */
+    struct critical_site *pNext;
+
+    /* The source file and line of the ENTER_CRITICAL_SECTION */
+    const char_t *pFile;
+
+    u32_t line;
+
+    /* The site has been linked into the profile list */
+    b_t linked;
+
+    /* The enter/exit pairs number */
+    u32_t count;
+
+    /* The longest masked cycles */
+    u32_t max_cycles;
+
+    /* The log2 buckets of the masked cycles, the bucket n counts [2^n, 2^(n+1)) cycles and the last one takes the rest */
+    u32_t histogram[TRACE_CRITICAL_SECTION_BUCKET_NUMBER];
+} critical_site_t;
+
+/**
+ * Data structure for the wake-to-run latency snapshot of a thread.
+ */
+typedef struct {
+    u32_t count;
+
+    u32_t min_us;
+
+    u32_t max_us;
+
+    /* The upper bound of the histogram bucket where the 99th percentile falls in */
+    u32_t p99_us;
+} trace_latency_t;
 
 typedef void (*pTrace_postcodeFunc_t)(u32_t, u32_t);
 typedef void (*pTrace_threadFunc_t)(const thread_context_t *pThread);
 typedef void (*pTrace_analyzeFunc_t)(const struct call_analyze analyze);
+typedef void (*pTrace_criticalFunc_t)(const critical_site_t *pSite);
+typedef void (*pTrace_latencyFunc_t)(const thread_context_t *pThread, const trace_latency_t *pLatency);
+typedef void (*pTrace_deadlineFunc_t)(const thread_context_t *pThread, const struct schedule_edf *pEdf);
+typedef void (*pTrace_contentionFunc_t)(const char_t *pName, const struct contention_statistics *pStatistics);
 
 u32_t _impl_trace_firmware_version_get(void);
 void _impl_trace_postcode_callback_register(const pTrace_postcodeFunc_t fn);
 b_t _impl_trace_postcode_failed_get(const pTrace_postcodeFunc_t fn);
 void _impl_trace_thread(const pTrace_threadFunc_t fn);
 void _impl_trace_analyze(const pTrace_analyzeFunc_t fn);
+void _impl_trace_thread_latency(const pTrace_latencyFunc_t fn);
+void _impl_trace_thread_latency_reset(void);
+void _impl_trace_deadline(const pTrace_deadlineFunc_t fn);
+void _impl_trace_mutex(const pTrace_contentionFunc_t fn);
+void _impl_trace_semaphore(const pTrace_contentionFunc_t fn);
+void _impl_trace_queue(const pTrace_contentionFunc_t fn);
+void _impl_trace_critical_section(const pTrace_criticalFunc_t fn);
+void _impl_trace_critical_section_reset(void);
+void trace_critical_section_record(critical_site_t *pSite, u32_t start);
+u32_t trace_histogram_bucket(u32_t value, u32_t number);
+
+#if (TRACE_CONTENTION_ENABLED)
+void trace_contention_acquire(struct contention_statistics *pStatistics, struct schedule_task *pWaiter);
+void trace_contention_block(struct contention_statistics *pStatistics, list_t *pList);
+void trace_contention_depth(struct contention_statistics *pStatistics, u16_t depth);
+#else
+/* The objects have no contention statistics, the arguments aren't evaluated */
+#define trace_contention_acquire(pStatistics, pWaiter)
+#define trace_contention_block(pStatistics, pList)
+#define trace_contention_depth(pStatistics, depth)
+#endif
 
 #endif /* _TRACE_H_ */
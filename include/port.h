@@ -282,6 +282,8 @@ static inline b_t port_isInThreadMode(void)
 #elif defined(ARCH_NATIVE_GCC)
 i32p_t kernel_svc_call(u32_t args_0, u32_t args_1, u32_t args_2, u32_t args_3);
 void port_run_theFirstThread(u32_t sp);
+u32_t *port_fpu_use(void);
+void port_fpu_model_get(u32_t *pTraps, u32_t *pSaves, u32_t *pRestores);
 
 #else
 #warning Not supported compiler type
@@ -295,5 +297,9 @@ b_t port_isInThreadMode(void);
 void port_setPendSV(void);
 void port_interrupt_init(void);
 u32_t port_stack_frame_init(void (*pEntryFunction)(void), u32_t *pAddress, u32_t size);
+u32_t port_cycle_count_get(void);
+void port_fpu_access_set(b_t enable);
+void port_fpu_context_save(u32_t *pRegs);
+void port_fpu_context_restore(const u32_t *pRegs);
 
 #endif /* _PORT_H_ */
@@ -83,6 +83,13 @@
  **/
 #define EVENT_RUNTIME_NUMBER_SUPPORTED (10u)
 
+/**
+ * This symbol defined the 32-bit word number of each event value, it's used by the wide event interfaces.
+ * The defaule value is set to 1. Your application will certainly need a different value so set this correctly.
+ * This is very often, but not always, according to the maximum signal lines number that one event carries.
+ **/
+#define EVENT_VALUE_WORD_NUMBER (1u)
+
 /**
  * This symbol defined the mutex instance number that your application is using.
  * The defaule value is set to 1. Your application will certainly need a different value so set this correctly.
@@ -90,6 +97,41 @@
  **/
 #define MUTEX_RUNTIME_NUMBER_SUPPORTED (10u)
 
+/**
+ * This symbol defined the times that the adaptive mutex yields to its ready hold thread of the same priority before the thread is blocked.
+ * The defaule value is set to 2. Your application will certainly need a different value so set this correctly.
+ * This is very often, but not always, according to the times that the hold thread gives up the processor in its critical section.
+ **/
+#define MUTEX_ADAPTIVE_YIELD_NUMBER (2u)
+
+/**
+ * This symbol defined the reader-writer lock instance number that your application is using.
+ * The defaule value is set to 1. Your application will certainly need a different value so set this correctly.
+ * This is very often, but not always, according to the actual reader-writer lock instance number that you created.
+ **/
+#define RWLOCK_RUNTIME_NUMBER_SUPPORTED (10u)
+
+/**
+ * This symbol defined the condition variable instance number that your application is using.
+ * The defaule value is set to 1. Your application will certainly need a different value so set this correctly.
+ * This is very often, but not always, according to the actual condition variable instance number that you created.
+ **/
+#define COND_RUNTIME_NUMBER_SUPPORTED (10u)
+
+/**
+ * This symbol defined the barrier instance number that your application is using.
+ * The defaule value is set to 1. Your application will certainly need a different value so set this correctly.
+ * This is very often, but not always, according to the actual barrier instance number that you created.
+ **/
+#define BARRIER_RUNTIME_NUMBER_SUPPORTED (10u)
+
+/**
+ * This symbol defined the countdown latch instance number that your application is using.
+ * The defaule value is set to 1. Your application will certainly need a different value so set this correctly.
+ * This is very often, but not always, according to the actual countdown latch instance number that you created.
+ **/
+#define LATCH_RUNTIME_NUMBER_SUPPORTED (10u)
+
 /**
  * This symbol defined the queue instance number that your application is using.
  * The defaule value is set to 1. Your application will certainly need a different value so set this correctly.
@@ -97,6 +139,20 @@
  **/
 #define QUEUE_RUNTIME_NUMBER_SUPPORTED (10u)
 
+/**
+ * This symbol defined the message priority level number of the priority queue, it's up to 32.
+ * The defaule value is set to 8. Your application will certainly need a different value so set this correctly.
+ * This is very often, but not always, according to the message classes that overtake each other.
+ **/
+#define QUEUE_PRIORITY_NUMBER (8u)
+
+/**
+ * This symbol defined the stream buffer and message buffer instance number that your application is using.
+ * The defaule value is set to 1. Your application will certainly need a different value so set this correctly.
+ * This is very often, but not always, according to the actual stream buffer instance number that you created.
+ **/
+#define STREAM_RUNTIME_NUMBER_SUPPORTED (10u)
+
 /**
  * This symbol defined the timer instance number that your application is using.
  * The defaule value is set to 1. Your application will certainly need a different value so set this correctly.
@@ -134,4 +190,64 @@
  **/
 #define THREAD_PSP_WITH_PRIVILEGED (10u)
 
+/**
+ * This symbol enables the wake-to-run latency histogram of each thread, it's the time between the thread is woken up and it runs.
+ * The defaule value is set to 0. It costs the histogram in each thread context and one system time read at the wake up and at the
+ * context switch, so set it only when you are tuning the thread priorities.
+ **/
+#define TRACE_SCHEDULE_LATENCY_ENABLED (0u)
+
+/**
+ * This symbol defined the log2 bucket number of the wake-to-run latency histogram in microseconds.
+ * The defaule value is set to 16, the last bucket takes all the latency longer than 32768 microseconds.
+ **/
+#define TRACE_SCHEDULE_LATENCY_BUCKET_NUMBER (16u)
+
+/**
+ * This symbol enables the critical section profile, every kernel critical section is timestamped with the cycle counter.
+ * The defaule value is set to 0. It adds a few cycles into every critical section, so set it only when you are looking for the longest
+ * interrupt masked region. The ARMv6-M and ARMv8-M baseline cores have no DWT cycle counter and don't support it.
+ **/
+#define TRACE_CRITICAL_SECTION_ENABLED (0u)
+
+/**
+ * This symbol defined the log2 bucket number of the critical section profile histogram.
+ * The defaule value is set to 16, the last bucket takes all the critical sections longer than 32768 cycles.
+ **/
+#define TRACE_CRITICAL_SECTION_BUCKET_NUMBER (16u)
+
+/**
+ * This symbol enables the contention statistics of the mutexes, semaphores and queues.
+ * The defaule value is set to 0. It costs the statistics in each object context and one system time read at each block and wake up,
+ * so set it only when you are looking for the hot lock.
+ **/
+#define TRACE_CONTENTION_ENABLED (0u)
+
+/**
+ * This symbol defined the longest interval that the coroutine group polls its coroutines waiting for the OS_CO_WAIT_UNTIL condition.
+ * The defaule value is set to 10, the kernel object waits don't poll, the object post and the os_coroutine_notify wake the group up.
+ **/
+#define COROUTINE_POLL_INTERVAL_MS (10u)
+
+/**
+ * This symbol enables the earliest deadline first thread class, the deadline threads are ordered by their absolute deadline.
+ * The defaule value is set to 0. It costs the deadline context in each thread context and the deadline compare in the schedule order.
+ **/
+#define THREAD_DEADLINE_ENABLED (0u)
+
+/**
+ * This symbol enables the thread execution budget, the thread that exhausts its budget runs at the lowest application priority until
+ * the next replenishment.
+ * The defaule value is set to 0. It costs the budget context and timer in each thread context and the budget charge in each schedule request.
+ **/
+#define THREAD_BUDGET_ENABLED (0u)
+
+/**
+ * This symbol defined the lazy FPU context switch, the FPU registers stay with their owner thread and they're switched only when the other
+ * thread executes a floating point instruction, which traps into the UsageFault. The interrupt handlers mustn't use the FPU with it.
+ * The defaule value is set to 0. The host port models the FPU in software, the thread calls port_fpu_use() where the core executes a
+ * floating point instruction, and port_fpu_model_get() counts the traps, saves and restores to check the statistics with.
+ **/
+#define FPU_LAZY_SWITCH_ENABLED (0u)
+
 #endif /* _ATOS_CONFIGURATION_H_ */
@@ -0,0 +1,433 @@
+/**
+ * Copyright (c) Riven Zheng (zhengheiot@gmail.com).
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ **/
+#include "kernel.h"
+#include "timer.h"
+#include "postcode.h"
+#include "trace.h"
+#include "init.h"
+
+/**
+ * Local unique postcode.
+ */
+#define PC_EOR PC_IER(PC_OS_CMPT_BARRIER_12)
+
+/**
+ * @brief Check if the barrier unique id if is's invalid.
+ *
+ * @param id The provided unique id.
+ *
+ * @return The true is invalid, otherwise is valid.
+ */
+static b_t _barrier_context_isInvalid(barrier_context_t *pCurBarrier)
+{
+    u32_t start, end;
+    INIT_SECTION_FIRST(INIT_SECTION_OS_BARRIER_LIST, start);
+    INIT_SECTION_LAST(INIT_SECTION_OS_BARRIER_LIST, end);
+
+    return ((u32_t)pCurBarrier < start || (u32_t)pCurBarrier >= end) ? true : false;
+}
+
+/**
+ * @brief Check if the barrier object if is's initialized.
+ *
+ * @param id The provided unique id.
+ *
+ * @return The true is initialized, otherwise is uninitialized.
+ */
+static b_t _barrier_context_isInit(barrier_context_t *pCurBarrier)
+{
+    return ((pCurBarrier) ? (((pCurBarrier->head.cs) ? (true) : (false))) : false);
+}
+
+/**
+ * @brief Check if the latch unique id if is's invalid.
+ *
+ * @param id The provided unique id.
+ *
+ * @return The true is invalid, otherwise is valid.
+ */
+static b_t _latch_context_isInvalid(latch_context_t *pCurLatch)
+{
+    u32_t start, end;
+    INIT_SECTION_FIRST(INIT_SECTION_OS_LATCH_LIST, start);
+    INIT_SECTION_LAST(INIT_SECTION_OS_LATCH_LIST, end);
+
+    return ((u32_t)pCurLatch < start || (u32_t)pCurLatch >= end) ? true : false;
+}
+
+/**
+ * @brief Check if the latch object if is's initialized.
+ *
+ * @param id The provided unique id.
+ *
+ * @return The true is initialized, otherwise is uninitialized.
+ */
+static b_t _latch_context_isInit(latch_context_t *pCurLatch)
+{
+    return ((pCurLatch) ? (((pCurLatch->head.cs) ? (true) : (false))) : false);
+}
+
+/**
+ * @brief Take the blocking result after the privilege call.
+ *
+ * @param postcode The result of privilege call.
+ *
+ * @return The result of the operation.
+ */
+static i32p_t _barrier_result_take(i32p_t postcode)
+{
+    ENTER_CRITICAL_SECTION();
+
+    if (postcode == PC_OS_WAIT_UNAVAILABLE) {
+        postcode = kernel_schedule_result_take();
+    }
+
+    PC_IF(postcode, PC_PASS_INFO)
+    {
+        if (postcode != PC_OS_WAIT_TIMEOUT) {
+            postcode = 0;
+        }
+    }
+
+    EXIT_CRITICAL_SECTION();
+    return postcode;
+}
+
+/**
+ * @brief The waiter timed out and left the q_list before the round is released, its arrival is withdrawn at once.
+ *
+ * @param pCtx The pointer of the barrier.
+ */
+static void _barrier_pend_timeout(void *pCtx)
+{
+    barrier_context_t *pCurBarrier = (barrier_context_t *)pCtx;
+
+    pCurBarrier->remains++;
+}
+
+/**
+ * @brief It's sub-routine running at privilege mode.
+ *
+ * @param pArgs The function argument packages.
+ *
+ * @return The result of privilege routine.
+ */
+static u32_t _barrier_init_privilege_routine(arguments_t *pArgs)
+{
+    ENTER_CRITICAL_SECTION();
+
+    u16_t parties = (u16_t)(pArgs[0].u16_val);
+    const char_t *pName = (const char_t *)(pArgs[1].pch_val);
+
+    barrier_context_t *pCurBarrier = (barrier_context_t *)init_slot_take(INIT_SLOT_BARRIER);
+    if (!pCurBarrier) {
+        EXIT_CRITICAL_SECTION();
+        return 0u;
+    }
+
+    os_memset((char_t *)pCurBarrier, 0x0u, sizeof(barrier_context_t));
+    pCurBarrier->head.cs = CS_INITED;
+    pCurBarrier->head.pName = pName;
+
+    pCurBarrier->parties = parties;
+    pCurBarrier->remains = parties;
+
+    EXIT_CRITICAL_SECTION();
+    return (u32_t)pCurBarrier;
+}
+
+/**
+ * @brief It's sub-routine running at privilege mode.
+ *
+ * @param pArgs The function argument packages.
+ *
+ * @return The result of privilege routine.
+ */
+static i32p_t _barrier_wait_privilege_routine(arguments_t *pArgs)
+{
+    ENTER_CRITICAL_SECTION();
+
+    barrier_context_t *pCurBarrier = (barrier_context_t *)pArgs[0].u32_val;
+    u32_t timeout_ms = (u32_t)pArgs[1].u32_val;
+    thread_context_t *pCurThread = NULL;
+    i32p_t postcode = 0;
+
+    pCurBarrier->remains--;
+    if (!pCurBarrier->remains) {
+        /* The last arrival releases all waiters and starts the next round */
+        pCurBarrier->remains = pCurBarrier->parties;
+        postcode = schedule_entry_all_trigger(&pCurBarrier->q_list, 0u);
+
+        EXIT_CRITICAL_SECTION();
+        return postcode;
+    }
+
+    pCurThread = kernel_thread_runContextGet();
+    postcode = schedule_exit_trigger(&pCurThread->task, pCurBarrier, NULL, &pCurBarrier->q_list, timeout_ms);
+    schedule_pend_timeout_set(&pCurThread->task, _barrier_pend_timeout);
+    PC_IF(postcode, PC_PASS)
+    {
+        postcode = PC_OS_WAIT_UNAVAILABLE;
+    }
+
+    EXIT_CRITICAL_SECTION();
+    return postcode;
+}
+
+/**
+ * @brief It's sub-routine running at privilege mode.
+ *
+ * @param pArgs The function argument packages.
+ *
+ * @return The result of privilege routine.
+ */
+static u32_t _latch_init_privilege_routine(arguments_t *pArgs)
+{
+    ENTER_CRITICAL_SECTION();
+
+    u32_t count = (u32_t)(pArgs[0].u32_val);
+    const char_t *pName = (const char_t *)(pArgs[1].pch_val);
+
+    latch_context_t *pCurLatch = (latch_context_t *)init_slot_take(INIT_SLOT_LATCH);
+    if (!pCurLatch) {
+        EXIT_CRITICAL_SECTION();
+        return 0u;
+    }
+
+    os_memset((char_t *)pCurLatch, 0x0u, sizeof(latch_context_t));
+    pCurLatch->head.cs = CS_INITED;
+    pCurLatch->head.pName = pName;
+
+    pCurLatch->count = count;
+
+    EXIT_CRITICAL_SECTION();
+    return (u32_t)pCurLatch;
+}
+
+/**
+ * @brief It's sub-routine running at privilege mode.
+ *
+ * @param pArgs The function argument packages.
+ *
+ * @return The result of privilege routine.
+ */
+static i32p_t _latch_count_down_privilege_routine(arguments_t *pArgs)
+{
+    ENTER_CRITICAL_SECTION();
+
+    latch_context_t *pCurLatch = (latch_context_t *)pArgs[0].u32_val;
+    i32p_t postcode = 0;
+
+    if (!pCurLatch->count) {
+        // The latch was released already.
+        EXIT_CRITICAL_SECTION();
+        return postcode;
+    }
+
+    pCurLatch->count--;
+    if (!pCurLatch->count) {
+        postcode = schedule_entry_all_trigger(&pCurLatch->q_list, 0u);
+    }
+
+    EXIT_CRITICAL_SECTION();
+    return postcode;
+}
+
+/**
+ * @brief It's sub-routine running at privilege mode.
+ *
+ * @param pArgs The function argument packages.
+ *
+ * @return The result of privilege routine.
+ */
+static i32p_t _latch_wait_privilege_routine(arguments_t *pArgs)
+{
+    ENTER_CRITICAL_SECTION();
+
+    latch_context_t *pCurLatch = (latch_context_t *)pArgs[0].u32_val;
+    u32_t timeout_ms = (u32_t)pArgs[1].u32_val;
+    thread_context_t *pCurThread = NULL;
+    i32p_t postcode = 0;
+
+    if (!pCurLatch->count) {
+        EXIT_CRITICAL_SECTION();
+        return postcode;
+    }
+
+    pCurThread = kernel_thread_runContextGet();
+    postcode = schedule_exit_trigger(&pCurThread->task, pCurLatch, NULL, &pCurLatch->q_list, timeout_ms);
+    PC_IF(postcode, PC_PASS)
+    {
+        postcode = PC_OS_WAIT_UNAVAILABLE;
+    }
+
+    EXIT_CRITICAL_SECTION();
+    return postcode;
+}
+
+/**
+ * @brief Initialize a new barrier.
+ *
+ * @param parties The thread number that must arrive to release the barrier.
+ * @param pName The barrier name.
+ *
+ * @return The barrier unique id.
+ */
+u32_t _impl_barrier_init(u16_t parties, const char_t *pName)
+{
+    if (!parties) {
+        return 0u;
+    }
+
+    arguments_t arguments[] = {
+        [0] = {.u16_val = (u16_t)parties},
+        [1] = {.pch_val = (const char_t *)pName},
+    };
+
+    return kernel_privilege_invoke((const void *)_barrier_init_privilege_routine, arguments);
+}
+
+/**
+ * @brief Arrive at the barrier and wait until all parties arrived.
+ *
+ * @param id The barrier unique id.
+ * @param timeout_ms The barrier waiting timeout setting.
+ *
+ * @return The result of the operation.
+ */
+i32p_t _impl_barrier_wait(u32_t ctx, u32_t timeout_ms)
+{
+    barrier_context_t *pCtx = (barrier_context_t *)ctx;
+    if (_barrier_context_isInvalid(pCtx)) {
+        return PC_EOR;
+    }
+
+    if (!_barrier_context_isInit(pCtx)) {
+        return PC_EOR;
+    }
+
+    if (!timeout_ms) {
+        return PC_EOR;
+    }
+
+    if (!kernel_isInThreadMode()) {
+        return PC_EOR;
+    }
+
+    arguments_t arguments[] = {
+        [0] = {.u32_val = (u32_t)ctx},
+        [1] = {.u32_val = (u32_t)timeout_ms},
+    };
+
+    i32p_t postcode = kernel_privilege_invoke((const void *)_barrier_wait_privilege_routine, arguments);
+    return _barrier_result_take(postcode);
+}
+
+/**
+ * @brief Initialize a new countdown latch.
+ *
+ * @param count The count down number to release the waiters.
+ * @param pName The latch name.
+ *
+ * @return The latch unique id.
+ */
+u32_t _impl_latch_init(u32_t count, const char_t *pName)
+{
+    arguments_t arguments[] = {
+        [0] = {.u32_val = (u32_t)count},
+        [1] = {.pch_val = (const char_t *)pName},
+    };
+
+    return kernel_privilege_invoke((const void *)_latch_init_privilege_routine, arguments);
+}
+
+/**
+ * @brief Count the latch down, the last one releases all waiters.
+ *
+ * @param id The latch unique id.
+ *
+ * @return The result of the operation.
+ */
+i32p_t _impl_latch_count_down(u32_t ctx)
+{
+    latch_context_t *pCtx = (latch_context_t *)ctx;
+    if (_latch_context_isInvalid(pCtx)) {
+        return PC_EOR;
+    }
+
+    if (!_latch_context_isInit(pCtx)) {
+        return PC_EOR;
+    }
+
+    arguments_t arguments[] = {
+        [0] = {.u32_val = (u32_t)ctx},
+    };
+
+    return kernel_privilege_invoke((const void *)_latch_count_down_privilege_routine, arguments);
+}
+
+/**
+ * @brief Wait until the latch is counted down to zero.
+ *
+ * @param id The latch unique id.
+ * @param timeout_ms The latch waiting timeout setting.
+ *
+ * @return The result of the operation.
+ */
+i32p_t _impl_latch_wait(u32_t ctx, u32_t timeout_ms)
+{
+    latch_context_t *pCtx = (latch_context_t *)ctx;
+    if (_latch_context_isInvalid(pCtx)) {
+        return PC_EOR;
+    }
+
+    if (!_latch_context_isInit(pCtx)) {
+        return PC_EOR;
+    }
+
+    if (!pCtx->count) {
+        /* The released latch doesn't need the privilege call */
+        return 0;
+    }
+
+    if (!timeout_ms) {
+        return PC_EOR;
+    }
+
+    if (!kernel_isInThreadMode()) {
+        return PC_EOR;
+    }
+
+    arguments_t arguments[] = {
+        [0] = {.u32_val = (u32_t)ctx},
+        [1] = {.u32_val = (u32_t)timeout_ms},
+    };
+
+    i32p_t postcode = kernel_privilege_invoke((const void *)_latch_wait_privilege_routine, arguments);
+    return _barrier_result_take(postcode);
+}
+
+/**
+ * @brief Get the remaining count of the latch.
+ *
+ * @param id The latch unique id.
+ *
+ * @return The remaining count.
+ */
+u32_t _impl_latch_count_get(u32_t ctx)
+{
+    latch_context_t *pCtx = (latch_context_t *)ctx;
+    if (_latch_context_isInvalid(pCtx)) {
+        return 0u;
+    }
+
+    if (!_latch_context_isInit(pCtx)) {
+        return 0u;
+    }
+
+    return pCtx->count;
+}
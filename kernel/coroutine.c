@@ -0,0 +1,293 @@
+/**
+ * Copyright (c) Riven Zheng (zhengheiot@gmail.com).
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ **/
+#include "at_rtos.h"
+#include "kernel.h"
+#include "timer.h"
+#include "postcode.h"
+
+/**
+ * Local unique postcode.
+ */
+#define PC_EOR PC_IER(PC_OS_CMPT_COROUTINE_14)
+
+/**
+ * @brief Wake the group host thread up, or let it take another pass when it's running the coroutines.
+ *
+ * @param pCurGroup The pointer of the coroutine group.
+ *
+ * @return The result of the operation.
+ */
+static i32p_t _coroutine_group_wakeup(struct coroutine_group *pCurGroup)
+{
+    ENTER_CRITICAL_SECTION();
+    struct schedule_task *pCurTask = pCurGroup->pTask;
+    i32p_t postcode = 0;
+
+    if ((pCurTask) && (pCurTask->pPendCtx == (void *)pCurGroup)) {
+        /* The host thread is waiting, the notification wakes it up */
+        timeout_remove(&pCurTask->expire, true);
+        postcode = schedule_entry_trigger(pCurTask, 0u);
+    } else {
+        /* The host thread is running the coroutines, it takes another pass before it waits */
+        pCurGroup->notified = true;
+    }
+
+    EXIT_CRITICAL_SECTION();
+    return postcode;
+}
+
+/**
+ * @brief It's sub-routine running at privilege mode.
+ *
+ * @param pArgs The function argument packages.
+ *
+ * @return The result of privilege routine.
+ */
+static i32p_t _coroutine_notify_privilege_routine(arguments_t *pArgs)
+{
+    return _coroutine_group_wakeup((struct coroutine_group *)pArgs[0].pv_val);
+}
+
+/**
+ * @brief It's sub-routine running at privilege mode.
+ *
+ * @param pArgs The function argument packages.
+ *
+ * @return The result of privilege routine.
+ */
+static i32p_t _coroutine_group_wait_privilege_routine(arguments_t *pArgs)
+{
+    ENTER_CRITICAL_SECTION();
+    struct coroutine_group *pCurGroup = (struct coroutine_group *)pArgs[0].pv_val;
+    u32_t timeout_ms = (u32_t)pArgs[1].u32_val;
+    i32p_t postcode = 0;
+
+    if (pCurGroup->notified) {
+        pCurGroup->notified = false;
+        EXIT_CRITICAL_SECTION();
+        return postcode;
+    }
+
+    thread_context_t *pCurThread = kernel_thread_runContextGet();
+    pCurGroup->pTask = &pCurThread->task;
+    postcode = schedule_exit_trigger(&pCurThread->task, pCurGroup, NULL, schedule_waitList(), timeout_ms);
+
+    EXIT_CRITICAL_SECTION();
+    return postcode;
+}
+
+/**
+ * @brief It's sub-routine running at privilege mode.
+ *
+ * @param pArgs The function argument packages.
+ *
+ * @return The result of privilege routine.
+ */
+static i32p_t _coroutine_add_privilege_routine(arguments_t *pArgs)
+{
+    ENTER_CRITICAL_SECTION();
+    struct coroutine_group *pCurGroup = (struct coroutine_group *)pArgs[0].pv_val;
+    struct coroutine_context *pCurCo = (struct coroutine_context *)pArgs[1].pv_val;
+
+    pCurCo->lc = 0u;
+    pCurCo->sleep = false;
+    pCurCo->pGroup = pCurGroup;
+    pCurCo->subscribed = false;
+    pCurCo->pNext = pCurGroup->pHead;
+    pCurGroup->pHead = pCurCo;
+
+    i32p_t postcode = _coroutine_notify_privilege_routine(pArgs);
+
+    EXIT_CRITICAL_SECTION();
+    return postcode;
+}
+
+/**
+ * @brief It's sub-routine running at privilege mode.
+ *
+ * @param pArgs The function argument packages.
+ *
+ * @return The result of privilege routine.
+ */
+static i32p_t _coroutine_remove_privilege_routine(arguments_t *pArgs)
+{
+    ENTER_CRITICAL_SECTION();
+    struct coroutine_group *pCurGroup = (struct coroutine_group *)pArgs[0].pv_val;
+    struct coroutine_context *pCurCo = (struct coroutine_context *)pArgs[1].pv_val;
+
+    struct coroutine_context **ppCo = &pCurGroup->pHead;
+    while (*ppCo) {
+        if (*ppCo == pCurCo) {
+            *ppCo = pCurCo->pNext;
+            pCurCo->pNext = NULL;
+            break;
+        }
+        ppCo = &(*ppCo)->pNext;
+    }
+
+    EXIT_CRITICAL_SECTION();
+    return 0;
+}
+
+/**
+ * @brief Subscribe the coroutine group to the kernel object that the coroutine polled without success, it's called in the object
+ * critical section. The object keeps one group, the coroutine of the other group keeps polling it.
+ *
+ * @param pCo The pointer of the coroutine.
+ * @param ppSubscriber The pointer of the object subscriber.
+ */
+void coroutine_object_subscribe(struct coroutine_context *pCo, struct coroutine_group **ppSubscriber)
+{
+    if ((*ppSubscriber) && (*ppSubscriber != pCo->pGroup)) {
+        return;
+    }
+
+    *ppSubscriber = pCo->pGroup;
+    pCo->subscribed = true;
+}
+
+/**
+ * @brief Wake the subscribed coroutine group up after the kernel object is posted, the group subscribes it again if it's still
+ * unavailable.
+ *
+ * @param ppSubscriber The pointer of the object subscriber.
+ */
+void coroutine_object_post(struct coroutine_group **ppSubscriber)
+{
+    struct coroutine_group *pCurGroup = *ppSubscriber;
+    if (!pCurGroup) {
+        return;
+    }
+
+    *ppSubscriber = NULL;
+    _coroutine_group_wakeup(pCurGroup);
+}
+
+/**
+ * @brief Add a coroutine into the group, it starts from the beginning at the next group pass.
+ *
+ * @param pGroup The pointer of the coroutine group.
+ * @param pCo The pointer of the coroutine.
+ *
+ * @return The result of the operation.
+ */
+i32p_t _impl_coroutine_add(struct coroutine_group *pGroup, struct coroutine_context *pCo)
+{
+    if ((!pGroup) || (!pCo) || (!pCo->pEntryFunc)) {
+        return PC_EOR;
+    }
+
+    arguments_t arguments[] = {
+        [0] = {.pv_val = (void *)pGroup},
+        [1] = {.pv_val = (void *)pCo},
+    };
+
+    return kernel_privilege_invoke((const void *)_coroutine_add_privilege_routine, arguments);
+}
+
+/**
+ * @brief Wake the group host thread up to run the coroutines again, it can be called in the interrupt content.
+ *
+ * @param pGroup The pointer of the coroutine group.
+ *
+ * @return The result of the operation.
+ */
+i32p_t _impl_coroutine_notify(struct coroutine_group *pGroup)
+{
+    if (!pGroup) {
+        return PC_EOR;
+    }
+
+    arguments_t arguments[] = {
+        [0] = {.pv_val = (void *)pGroup},
+    };
+
+    return kernel_privilege_invoke((const void *)_coroutine_notify_privilege_routine, arguments);
+}
+
+/**
+ * @brief Set the coroutine wake time, the group doesn't run it until the time is reached.
+ *
+ * @param pCo The pointer of the coroutine.
+ * @param ms The sleep time.
+ */
+void _impl_coroutine_sleep_set(struct coroutine_context *pCo, u32_t ms)
+{
+    pCo->wake_ms = os_timer_system_total_ms() + ms;
+    pCo->sleep = true;
+}
+
+/**
+ * @brief Run the coroutines of the group in the calling thread, it never returns.
+ *
+ * @param pGroup The pointer of the coroutine group.
+ *
+ * @return The result of the operation if the group can't be run.
+ */
+i32p_t _impl_coroutine_group_run(struct coroutine_group *pGroup)
+{
+    if (!pGroup) {
+        return PC_EOR;
+    }
+
+    if (!kernel_isInThreadMode()) {
+        return PC_EOR;
+    }
+
+    while (1) {
+        u32_t now_ms = os_timer_system_total_ms();
+        u32_t wait_ms = OS_TIME_FOREVER_VAL;
+        b_t progress = false;
+
+        struct coroutine_context *pCurCo = pGroup->pHead;
+        while (pCurCo) {
+            struct coroutine_context *pNextCo = pCurCo->pNext;
+
+            if (pCurCo->sleep) {
+                i32_t remain_ms = (i32_t)(pCurCo->wake_ms - now_ms);
+                if (remain_ms > 0) {
+                    wait_ms = MINI_AB(wait_ms, (u32_t)remain_ms);
+                    pCurCo = pNextCo;
+                    continue;
+                }
+                pCurCo->sleep = false;
+            }
+
+            u16_t lc = pCurCo->lc;
+            pCurCo->subscribed = false;
+            u8_t state = pCurCo->pEntryFunc(pCurCo);
+            if (state == OS_CO_EXITED) {
+                arguments_t arguments[] = {
+                    [0] = {.pv_val = (void *)pGroup},
+                    [1] = {.pv_val = (void *)pCurCo},
+                };
+                kernel_privilege_invoke((const void *)_coroutine_remove_privilege_routine, arguments);
+                progress = true;
+            } else if ((state == OS_CO_YIELDED) || (lc != pCurCo->lc)) {
+                /* The other coroutines could be unblocked by its progress */
+                progress = true;
+            } else if ((!pCurCo->sleep) && (!pCurCo->subscribed)) {
+                /* It polls a condition that doesn't wake the group up */
+                wait_ms = MINI_AB(wait_ms, COROUTINE_POLL_INTERVAL_MS);
+            }
+            pCurCo = pNextCo;
+        }
+
+        if ((progress) || (!wait_ms)) {
+            continue;
+        }
+
+        arguments_t arguments[] = {
+            [0] = {.pv_val = (void *)pGroup},
+            [1] = {.u32_val = (u32_t)wait_ms},
+        };
+        kernel_privilege_invoke((const void *)_coroutine_group_wait_privilege_routine, arguments);
+    }
+
+    // Unreachable.
+    return PC_EOR;
+}
@@ -44,61 +44,80 @@ static b_t _event_context_isInit(event_context_t *pCurEvt)
 }
 
 /**
- * @brief The event schedule routine execute the the pendsv context.
+ * @brief Calculate the triggered bits word by word according to the event setting.
  *
- * @param id The unique id of the entry thread.
+ * @param pCurEvent The pointer of the current event context.
+ * @param pPrev The pointer of the previous value words.
+ * @param pVal The pointer of the current value words.
+ * @param pTrigger The pointer of the triggered output words.
+ * @param words The number of the words to be calculated.
  */
-static void _event_schedule(void *pTask)
+static void _event_trigger_calculate(event_context_t *pCurEvent, const u32_t *pPrev, const u32_t *pVal, u32_t *pTrigger, u8_t words)
 {
-    struct schedule_task *pCurTask = (struct schedule_task *)pTask;
+    u32_t changed, any, edge, level, trigger;
 
-    timeout_remove(&pCurTask->expire, true);
+    for (u8_t i = 0u; i < words; i++) {
+        trigger = 0u;
+        changed = pPrev[i] ^ pVal[i];
+        if (changed) {
+            // Any position
+            any = pCurEvent->anyMask[i];
 
-    u32_t changed, any, edge, level, trigger = 0u;
-    event_context_t *pCurEvent = (event_context_t *)pCurTask->pPendCtx;
-    event_sch_t *pEvt_sche = (event_sch_t *)pCurTask->pPendData;
-    if (!pEvt_sche) {
-        return;
-    }
-    changed = pEvt_sche->pEvtVal->value ^ pCurEvent->value;
-    if (changed) {
-        // Any position
-        any = pCurEvent->anyMask;
+            // Changings trigger.
+            trigger = any & changed;
+
+            // Edge position
+            edge = pCurEvent->modeMask[i];
+            edge &= ~pCurEvent->anyMask[i];
 
-        // Changings trigger.
-        trigger = any & changed;
+            // Edge rise trigger.
+            trigger |= edge & pVal[i] & pCurEvent->dirMask[i] & changed;
 
-        // Edge position
-        edge = pCurEvent->modeMask;
-        edge &= ~pCurEvent->anyMask;
+            // Edge fall trigger.
+            trigger |= edge & ~pVal[i] & ~pCurEvent->dirMask[i] & changed;
 
-        // Edge rise trigger.
-        trigger |= edge & pCurEvent->value & pCurEvent->dirMask & changed;
+            // Level position
+            level = ~pCurEvent->modeMask[i];
+            level &= ~pCurEvent->anyMask[i];
 
-        // Edge fall trigger.
-        trigger |= edge & ~pCurEvent->value & ~pCurEvent->dirMask & changed;
+            // Level high trigger.
+            trigger |= level & pVal[i] & pCurEvent->dirMask[i] & changed;
 
-        // Level position
-        level = ~pCurEvent->modeMask;
-        level &= ~pCurEvent->anyMask;
+            // Level low trigger.
+            trigger |= level & ~pVal[i] & ~pCurEvent->dirMask[i] & changed;
+        }
 
-        // Level high trigger.
-        trigger |= level & pCurEvent->value & pCurEvent->dirMask & changed;
+        // Triggered bits
+        pTrigger[i] = trigger | pCurEvent->triggered[i];
+    }
+}
+
+/**
+ * @brief Report the triggered bits to the waiter if it's listening.
+ *
+ * @param pCurEvent The pointer of the current event context.
+ * @param pEvt_sch The pointer of the waiter event schedule data.
+ * @param pTrigger The pointer of the triggered words.
+ *
+ * @return The true indicates the waiter has been reported.
+ */
+static b_t _event_report(event_context_t *pCurEvent, event_sch_t *pEvt_sch, const u32_t *pTrigger)
+{
+    u32_t report = 0u;
 
-        // Level low trigger.
-        trigger |= level & ~pCurEvent->value & ~pCurEvent->dirMask & changed;
+    for (u8_t i = 0u; i < pEvt_sch->words; i++) {
+        report |= pTrigger[i] & pEvt_sch->listen[i];
     }
-    // Triggered bits
-    trigger |= pCurEvent->triggered;
-
-    pEvt_sche->pEvtVal->value = pCurEvent->value;
-    u32_t report = trigger & pEvt_sche->listen;
-    if (report) {
-        pEvt_sche->pEvtVal->trigger = trigger;
-        pCurEvent->triggered &= ~report;
+
+    if (!report) {
+        return false;
     }
 
-    pCurTask->exec.entry.result = 0;
+    for (u8_t i = 0u; i < pEvt_sch->words; i++) {
+        pEvt_sch->pTrigger[i] = pTrigger[i];
+        pCurEvent->triggered[i] &= ~(pTrigger[i] & pEvt_sch->listen[i]);
+    }
+    return true;
 }
 
 /**
@@ -112,39 +131,33 @@ static u32_t _event_init_privilege_routine(arguments_t *pArgs)
 {
     ENTER_CRITICAL_SECTION();
 
-    u32_t anyMask = (u32_t)(pArgs[0].u32_val);
-    u32_t modeMask = (u32_t)(pArgs[1].u32_val);
-    u32_t dirMask = (u32_t)(pArgs[2].u32_val);
-    u32_t init = (u32_t)(pArgs[3].u32_val);
+    const u32_t *pAnyMask = (const u32_t *)(pArgs[0].ptr_val);
+    const u32_t *pModeMask = (const u32_t *)(pArgs[1].ptr_val);
+    const u32_t *pDirMask = (const u32_t *)(pArgs[2].ptr_val);
+    const u32_t *pInit = (const u32_t *)(pArgs[3].ptr_val);
     const char_t *pName = (const char_t *)(pArgs[4].pch_val);
 
-    INIT_SECTION_FOREACH(INIT_SECTION_OS_EVENT_LIST, event_context_t, pCurEvent)
-    {
-        if (_event_context_isInvalid(pCurEvent)) {
-            break;
-        }
-
-        if (_event_context_isInit(pCurEvent)) {
-            continue;
-        }
-
-        os_memset((char_t *)pCurEvent, 0x0u, sizeof(event_context_t));
-        pCurEvent->head.cs = CS_INITED;
-        pCurEvent->head.pName = pName;
+    event_context_t *pCurEvent = (event_context_t *)init_slot_take(INIT_SLOT_EVENT);
+    if (!pCurEvent) {
+        EXIT_CRITICAL_SECTION();
+        return 0u;
+    }
 
-        pCurEvent->value = init;
-        pCurEvent->triggered = 0u;
-        pCurEvent->anyMask = anyMask;
-        pCurEvent->modeMask = modeMask;
-        pCurEvent->dirMask = dirMask;
-        pCurEvent->call.pEvtCallEntry = NULL;
+    os_memset((char_t *)pCurEvent, 0x0u, sizeof(event_context_t));
+    pCurEvent->head.cs = CS_INITED;
+    pCurEvent->head.pName = pName;
 
-        EXIT_CRITICAL_SECTION();
-        return (u32_t)pCurEvent;
-    };
+    for (u8_t i = 0u; i < EVENT_VALUE_WORD_NUMBER; i++) {
+        pCurEvent->value[i] = (pInit) ? (pInit[i]) : (0u);
+        pCurEvent->triggered[i] = 0u;
+        pCurEvent->anyMask[i] = (pAnyMask) ? (pAnyMask[i]) : (0u);
+        pCurEvent->modeMask[i] = (pModeMask) ? (pModeMask[i]) : (0u);
+        pCurEvent->dirMask[i] = (pDirMask) ? (pDirMask[i]) : (0u);
+    }
+    pCurEvent->call.pEvtCallEntry = NULL;
 
     EXIT_CRITICAL_SECTION();
-    return 0u;
+    return (u32_t)pCurEvent;
 }
 
 /**
@@ -160,7 +173,8 @@ static i32p_t _event_value_get_privilege_routine(arguments_t *pArgs)
 
     event_context_t *pCurEvent = (event_context_t *)pArgs[0].u32_val;
     u32_t *pValue = (u32_t *)pArgs[1].pv_val;
-    *pValue = pCurEvent->value;
+    u8_t words = (u8_t)pArgs[2].u8_val;
+    os_memcpy(pValue, pCurEvent->value, words * sizeof(u32_t));
 
     EXIT_CRITICAL_SECTION();
     return 0u;
@@ -178,53 +192,26 @@ static i32p_t _event_set_privilege_routine(arguments_t *pArgs)
     ENTER_CRITICAL_SECTION();
 
     event_context_t *pCurEvent = (event_context_t *)pArgs[0].u32_val;
-    u32_t set = (u32_t)pArgs[1].u32_val;
-    u32_t clear = (u32_t)pArgs[2].u32_val;
-    u32_t toggle = (u32_t)pArgs[3].u32_val;
+    const u32_t *pSet = (const u32_t *)pArgs[1].ptr_val;
+    const u32_t *pClear = (const u32_t *)pArgs[2].ptr_val;
+    const u32_t *pToggle = (const u32_t *)pArgs[3].ptr_val;
 
-    u32_t val = pCurEvent->value;
-    u32_t changed, any, edge, level, trigger = 0u;
+    u32_t val[EVENT_VALUE_WORD_NUMBER] = {0u};
+    u32_t trigger[EVENT_VALUE_WORD_NUMBER] = {0u};
+    u32_t reported[EVENT_VALUE_WORD_NUMBER] = {0u};
     i32p_t postcode = 0;
 
-    /// Clear bits
-    val &= ~clear;
-    // Set bits
-    val |= set;
-    // Toggle bits
-    val ^= toggle;
-
-    changed = val ^ pCurEvent->value;
-
-    // Any position
-    any = pCurEvent->anyMask;
-
-    // Changings trigger.
-    trigger = any & changed;
-
-    // Edge position
-    edge = pCurEvent->modeMask;
-    edge &= ~pCurEvent->anyMask;
-
-    // Edge rise trigger.
-    trigger |= edge & val & pCurEvent->dirMask & changed;
-
-    // Edge fall trigger.
-    trigger |= edge & ~val & ~pCurEvent->dirMask & changed;
-
-    // Level position
-    level = ~pCurEvent->modeMask;
-    level &= ~pCurEvent->anyMask;
-
-    // Level high trigger.
-    trigger |= level & val & pCurEvent->dirMask & changed;
-
-    // Level low trigger.
-    trigger |= level & ~val & ~pCurEvent->dirMask & changed;
-
-    // Triggered bits
-    trigger |= pCurEvent->triggered;
+    for (u8_t i = 0u; i < EVENT_VALUE_WORD_NUMBER; i++) {
+        val[i] = pCurEvent->value[i];
+        /// Clear bits
+        val[i] &= ~pClear[i];
+        // Set bits
+        val[i] |= pSet[i];
+        // Toggle bits
+        val[i] ^= pToggle[i];
+    }
+    _event_trigger_calculate(pCurEvent, pCurEvent->value, val, trigger, EVENT_VALUE_WORD_NUMBER);
 
-    u32_t report, reported = 0u;
     list_iterator_t it = {0u};
     list_t *pList = (list_t *)&pCurEvent->q_list;
     list_iterator_init(&it, pList);
@@ -232,14 +219,23 @@ static i32p_t _event_set_privilege_routine(arguments_t *pArgs)
     while (pCurTask) {
         event_sch_t *pEvt_sche = (event_sch_t *)pCurTask->pPendData;
         if (!pEvt_sche) {
+            EXIT_CRITICAL_SECTION();
             return PC_EOR;
         }
-        report = trigger & pEvt_sche->listen;
+
+        u32_t report = 0u;
+        for (u8_t i = 0u; i < pEvt_sche->words; i++) {
+            report |= trigger[i] & pEvt_sche->listen[i];
+        }
         if (report) {
-            reported |= report;
-            pEvt_sche->pEvtVal->trigger = trigger;
-            pEvt_sche->pEvtVal->value = val;
-            postcode = schedule_entry_trigger(pCurTask, _event_schedule, 0u);
+            for (u8_t i = 0u; i < pEvt_sche->words; i++) {
+                reported[i] |= trigger[i] & pEvt_sche->listen[i];
+                pEvt_sche->pTrigger[i] = trigger[i];
+                pEvt_sche->pValue[i] = val[i];
+            }
+            /* The waiter has taken the value and trigger, its timeout can't override the result any more */
+            timeout_remove(&pCurTask->expire, true);
+            postcode = schedule_entry_trigger(pCurTask, 0u);
             PC_IF(postcode, PC_ERROR)
             {
                 break;
@@ -247,8 +243,17 @@ static i32p_t _event_set_privilege_routine(arguments_t *pArgs)
         }
         pCurTask = (struct schedule_task *)list_iterator_next(&it);
     }
-    pCurEvent->triggered = (~reported) & trigger;
-    pCurEvent->value = val;
+
+    b_t triggered = false;
+    for (u8_t i = 0u; i < EVENT_VALUE_WORD_NUMBER; i++) {
+        pCurEvent->triggered[i] = (~reported[i]) & trigger[i];
+        pCurEvent->value[i] = val[i];
+        triggered |= (pCurEvent->triggered[i]) ? (true) : (false);
+    }
+
+    if (triggered) {
+        coroutine_object_post(&pCurEvent->pCoGroup);
+    }
 
     EXIT_CRITICAL_SECTION();
     return postcode;
@@ -268,57 +273,114 @@ static i32p_t _event_wait_privilege_routine(arguments_t *pArgs)
     event_context_t *pCurEvent = (event_context_t *)pArgs[0].u32_val;
     event_sch_t *pEvt_sch = (event_sch_t *)pArgs[1].pv_val;
     u32_t timeout_ms = (u32_t)pArgs[2].u32_val;
+    struct coroutine_context *pCurCo = (struct coroutine_context *)pArgs[3].pv_val;
     i32p_t postcode = 0;
 
     thread_context_t *pCurThread = kernel_thread_runContextGet();
-    struct evt_val *pEvtData = pEvt_sch->pEvtVal;
-    u32_t changed, any, edge, level, trigger = 0u;
+    u32_t trigger[EVENT_VALUE_WORD_NUMBER] = {0u};
+
+    _event_trigger_calculate(pCurEvent, pEvt_sch->pValue, pCurEvent->value, trigger, pEvt_sch->words);
+
+    os_memcpy(pEvt_sch->pValue, pCurEvent->value, pEvt_sch->words * sizeof(u32_t));
+    if (_event_report(pCurEvent, pEvt_sch, trigger)) {
+        EXIT_CRITICAL_SECTION();
+        return postcode;
+    }
+
+    if (timeout_ms == OS_TIME_NOWAIT_VAL) {
+        /* The caller polls it, it's not an error */
+        if (pCurCo) {
+            coroutine_object_subscribe(pCurCo, &pCurEvent->pCoGroup);
+        }
+        EXIT_CRITICAL_SECTION();
+        return PC_OS_WAIT_TIMEOUT;
+    }
+    postcode = schedule_exit_trigger(&pCurThread->task, pCurEvent, pEvt_sch, &pCurEvent->q_list, timeout_ms);
+    PC_IF(postcode, PC_PASS)
+    {
+        postcode = PC_OS_WAIT_UNAVAILABLE;
+    }
 
-    changed = pEvtData->value ^ pCurEvent->value;
-    if (changed) {
-        // Any position
-        any = pCurEvent->anyMask;
+    EXIT_CRITICAL_SECTION();
+    return postcode;
+}
 
-        // Changings trigger.
-        trigger = any & changed;
+/**
+ * @brief Check the event context and invoke the event set routine.
+ *
+ * @param ctx The event unique id.
+ * @param pSet The pointer of the value words set.
+ * @param pClear The pointer of the value words clear.
+ * @param pToggle The pointer of the value words toggle.
+ *
+ * @return The result of the operation.
+ */
+static i32p_t _event_set_invoke(u32_t ctx, const u32_t *pSet, const u32_t *pClear, const u32_t *pToggle)
+{
+    event_context_t *pCtx = (event_context_t *)ctx;
+    if (_event_context_isInvalid(pCtx)) {
+        return PC_EOR;
+    }
 
-        // Edge position
-        edge = pCurEvent->modeMask;
-        edge &= ~pCurEvent->anyMask;
+    if (!_event_context_isInit(pCtx)) {
+        return PC_EOR;
+    }
 
-        // Edge rise trigger.
-        trigger |= edge & pCurEvent->value & pCurEvent->dirMask & changed;
+    arguments_t arguments[] = {
+        [0] = {.u32_val = (u32_t)ctx},
+        [1] = {.ptr_val = (const void *)pSet},
+        [2] = {.ptr_val = (const void *)pClear},
+        [3] = {.ptr_val = (const void *)pToggle},
+    };
 
-        // Edge fall trigger.
-        trigger |= edge & ~pCurEvent->value & ~pCurEvent->dirMask & changed;
+    return kernel_privilege_invoke((const void *)_event_set_privilege_routine, arguments);
+}
 
-        // Level position
-        level = ~pCurEvent->modeMask;
-        level &= ~pCurEvent->anyMask;
+/**
+ * @brief Check the event context and invoke the event wait routine.
+ *
+ * @param ctx The event unique id.
+ * @param pEvt_sch The pointer of the event schedule data.
+ * @param timeout_ms The event wait timeout setting.
+ * @param pCo The pointer of the coroutine that polls it, or NULL.
+ *
+ * @return The result of the operation.
+ */
+static i32p_t _event_wait_invoke(u32_t ctx, event_sch_t *pEvt_sch, u32_t timeout_ms, struct coroutine_context *pCo)
+{
+    event_context_t *pCtx = (event_context_t *)ctx;
+    if (_event_context_isInvalid(pCtx)) {
+        return PC_EOR;
+    }
 
-        // Level high trigger.
-        trigger |= level & pCurEvent->value & pCurEvent->dirMask & changed;
+    if (!_event_context_isInit(pCtx)) {
+        return PC_EOR;
+    }
 
-        // Level low trigger.
-        trigger |= level & ~pCurEvent->value & ~pCurEvent->dirMask & changed;
+    if (!kernel_isInThreadMode()) {
+        return PC_EOR;
     }
 
-    // Triggered bits
-    trigger |= pCurEvent->triggered;
+    arguments_t arguments[] = {
+        [0] = {.u32_val = (u32_t)ctx},
+        [1] = {.pv_val = (void *)pEvt_sch},
+        [2] = {.u32_val = (u32_t)timeout_ms},
+        [3] = {.pv_val = (void *)pCo},
+    };
 
-    pEvtData->value = pCurEvent->value;
-    u32_t report = trigger & pEvt_sch->listen;
-    if (report) {
-        pEvtData->trigger = trigger;
-        pCurEvent->triggered &= ~report;
+    i32p_t postcode = kernel_privilege_invoke((const void *)_event_wait_privilege_routine, arguments);
 
-        EXIT_CRITICAL_SECTION();
-        return postcode;
+    ENTER_CRITICAL_SECTION();
+
+    if (postcode == PC_OS_WAIT_UNAVAILABLE) {
+        postcode = kernel_schedule_result_take();
     }
-    postcode = schedule_exit_trigger(&pCurThread->task, pCurEvent, pEvt_sch, &pCurEvent->q_list, timeout_ms, true);
-    PC_IF(postcode, PC_PASS)
+
+    PC_IF(postcode, PC_PASS_INFO)
     {
-        postcode = PC_OS_WAIT_UNAVAILABLE;
+        if (postcode != PC_OS_WAIT_TIMEOUT) {
+            postcode = 0;
+        }
     }
 
     EXIT_CRITICAL_SECTION();
@@ -338,9 +400,35 @@ static i32p_t _event_wait_privilege_routine(arguments_t *pArgs)
  */
 u32_t _impl_event_init(u32_t anyMask, u32_t modeMask, u32_t dirMask, u32_t init, const char_t *pName)
 {
+    u32_t any[EVENT_VALUE_WORD_NUMBER] = {anyMask};
+    u32_t mode[EVENT_VALUE_WORD_NUMBER] = {modeMask};
+    u32_t dir[EVENT_VALUE_WORD_NUMBER] = {dirMask};
+    u32_t val[EVENT_VALUE_WORD_NUMBER] = {init};
+
     arguments_t arguments[] = {
-        [0] = {.u32_val = (u32_t)anyMask}, [1] = {.u32_val = (u32_t)modeMask},       [2] = {.u32_val = (u32_t)dirMask},
-        [3] = {.u32_val = (u32_t)init},    [4] = {.pch_val = (const char_t *)pName},
+        [0] = {.ptr_val = (const void *)any}, [1] = {.ptr_val = (const void *)mode},  [2] = {.ptr_val = (const void *)dir},
+        [3] = {.ptr_val = (const void *)val}, [4] = {.pch_val = (const char_t *)pName},
+    };
+
+    return kernel_privilege_invoke((const void *)_event_init_privilege_routine, arguments);
+}
+
+/**
+ * @brief Initialize a new wide event, each mask has EVENT_VALUE_WORD_NUMBER words.
+ *
+ * @param pAnyMask: Changed bits always trigger = 1. otherwise, see dirMask below = 0.
+ * @param pModeMask: Level trigger = 0, Edge trigger = 1.
+ * @param pDirMask: Fall or Low trigger = 0, Rise or high trigger = 1.
+ * @param pInit: The init signal value.
+ * @param pName: The event name.
+ *
+ * @return The event unique id.
+ */
+u32_t _impl_event_wide_init(const u32_t *pAnyMask, const u32_t *pModeMask, const u32_t *pDirMask, const u32_t *pInit, const char_t *pName)
+{
+    arguments_t arguments[] = {
+        [0] = {.ptr_val = (const void *)pAnyMask}, [1] = {.ptr_val = (const void *)pModeMask}, [2] = {.ptr_val = (const void *)pDirMask},
+        [3] = {.ptr_val = (const void *)pInit},    [4] = {.pch_val = (const char_t *)pName},
     };
 
     return kernel_privilege_invoke((const void *)_event_init_privilege_routine, arguments);
@@ -368,22 +456,21 @@ i32p_t _impl_event_value_get(u32_t ctx, u32_t *pValue)
     arguments_t arguments[] = {
         [0] = {.u32_val = (u32_t)ctx},
         [1] = {.pv_val = (void *)pValue},
+        [2] = {.u8_val = 1u},
     };
 
     return kernel_privilege_invoke((const void *)_event_value_get_privilege_routine, arguments);
 }
 
 /**
- * @brief Set/clear/toggle event signal bits.
+ * @brief Read the whole event signal value words.
  *
  * @param id: Event unique id.
- * @param set: Event value bits set.
- * @param clear: Event value bits clear.
- * @param toggle: Event value bits toggle.
+ * @param pValue: The pointer of the private event value words.
  *
  * @return The result of the operation.
  */
-i32p_t _impl_event_set(u32_t ctx, u32_t set, u32_t clear, u32_t toggle)
+i32p_t _impl_event_wide_value_get(u32_t ctx, u32_t *pValue)
 {
     event_context_t *pCtx = (event_context_t *)ctx;
     if (_event_context_isInvalid(pCtx)) {
@@ -394,14 +481,53 @@ i32p_t _impl_event_set(u32_t ctx, u32_t set, u32_t clear, u32_t toggle)
         return PC_EOR;
     }
 
+    if (!pValue) {
+        return PC_EOR;
+    }
+
     arguments_t arguments[] = {
         [0] = {.u32_val = (u32_t)ctx},
-        [1] = {.u32_val = (u32_t)set},
-        [2] = {.u32_val = (u32_t)clear},
-        [3] = {.u32_val = (u32_t)toggle},
+        [1] = {.pv_val = (void *)pValue},
+        [2] = {.u8_val = EVENT_VALUE_WORD_NUMBER},
     };
 
-    return kernel_privilege_invoke((const void *)_event_set_privilege_routine, arguments);
+    return kernel_privilege_invoke((const void *)_event_value_get_privilege_routine, arguments);
+}
+
+/**
+ * @brief Set/clear/toggle event signal bits.
+ *
+ * @param id: Event unique id.
+ * @param set: Event value bits set.
+ * @param clear: Event value bits clear.
+ * @param toggle: Event value bits toggle.
+ *
+ * @return The result of the operation.
+ */
+i32p_t _impl_event_set(u32_t ctx, u32_t set, u32_t clear, u32_t toggle)
+{
+    u32_t set_words[EVENT_VALUE_WORD_NUMBER] = {set};
+    u32_t clear_words[EVENT_VALUE_WORD_NUMBER] = {clear};
+    u32_t toggle_words[EVENT_VALUE_WORD_NUMBER] = {toggle};
+
+    return _event_set_invoke(ctx, set_words, clear_words, toggle_words);
+}
+
+/**
+ * @brief Set/clear/toggle the wide event signal bits, the NULL pointer means no bits changed.
+ *
+ * @param id: Event unique id.
+ * @param pSet: Event value words set.
+ * @param pClear: Event value words clear.
+ * @param pToggle: Event value words toggle.
+ *
+ * @return The result of the operation.
+ */
+i32p_t _impl_event_wide_set(u32_t ctx, const u32_t *pSet, const u32_t *pClear, const u32_t *pToggle)
+{
+    static const u32_t none[EVENT_VALUE_WORD_NUMBER] = {0u};
+
+    return _event_set_invoke(ctx, (pSet) ? (pSet) : (none), (pClear) ? (pClear) : (none), (pToggle) ? (pToggle) : (none));
 }
 
 /**
@@ -416,52 +542,72 @@ i32p_t _impl_event_set(u32_t ctx, u32_t set, u32_t clear, u32_t toggle)
  */
 i32p_t _impl_event_wait(u32_t ctx, struct evt_val *pEvtData, u32_t listen_mask, u32_t timeout_ms)
 {
-    event_context_t *pCtx = (event_context_t *)ctx;
-    if (_event_context_isInvalid(pCtx)) {
-        return PC_EOR;
-    }
-
-    if (!_event_context_isInit(pCtx)) {
-        return PC_EOR;
-    }
-
     if (!pEvtData) {
         return PC_EOR;
     }
 
-    if (!timeout_ms) {
-        return PC_EOR;
-    }
+    event_sch_t evt_sch = {
+        .listen = {listen_mask},
+        .words = 1u,
+        .pValue = &pEvtData->value,
+        .pTrigger = &pEvtData->trigger,
+    };
 
-    if (!kernel_isInThreadMode()) {
+    return _event_wait_invoke(ctx, &evt_sch, timeout_ms, NULL);
+}
+
+/**
+ * @brief Wait a trigger event in the coroutine without waiting, the set wakes the coroutine group up when it's not triggered.
+ *
+ * @param id The event unique id.
+ * @param pEvtData The pointer of event value.
+ * @param listen_mask Current thread listen which bits in the event.
+ * @param pCo The pointer of the coroutine.
+ *
+ * @return The result of the operation.
+ */
+i32p_t _impl_event_co_wait(u32_t ctx, struct evt_val *pEvtData, u32_t listen_mask, struct coroutine_context *pCo)
+{
+    if ((!pEvtData) || (!pCo)) {
         return PC_EOR;
     }
 
     event_sch_t evt_sch = {
-        .listen = listen_mask,
-        .pEvtVal = pEvtData,
-    };
-    arguments_t arguments[] = {
-        [0] = {.u32_val = (u32_t)ctx},
-        [1] = {.pv_val = (void *)&evt_sch},
-        [2] = {.u32_val = (u32_t)timeout_ms},
+        .listen = {listen_mask},
+        .words = 1u,
+        .pValue = &pEvtData->value,
+        .pTrigger = &pEvtData->trigger,
     };
 
-    i32p_t postcode = kernel_privilege_invoke((const void *)_event_wait_privilege_routine, arguments);
-
-    ENTER_CRITICAL_SECTION();
+    return _event_wait_invoke(ctx, &evt_sch, OS_TIME_NOWAIT_VAL, pCo);
+}
 
-    if (postcode == PC_OS_WAIT_UNAVAILABLE) {
-        postcode = kernel_schedule_result_take();
+/**
+ * @brief Wait a trigger event with the multi-word listen mask.
+ *
+ * @param id The event unique id.
+ * @param pEvtData The pointer of wide event value.
+ * @param pListen Current thread listen which bits in the event words.
+ * @param timeout_ms The event wait timeout setting.
+ *
+ * @return The result of the operation.
+ */
+i32p_t _impl_event_wide_wait(u32_t ctx, struct evt_wide_val *pEvtData, const u32_t *pListen, u32_t timeout_ms)
+{
+    if (!pEvtData) {
+        return PC_EOR;
     }
 
-    PC_IF(postcode, PC_PASS_INFO)
-    {
-        if (postcode != PC_OS_WAIT_TIMEOUT) {
-            postcode = 0;
-        }
+    if (!pListen) {
+        return PC_EOR;
     }
 
-    EXIT_CRITICAL_SECTION();
-    return postcode;
+    event_sch_t evt_sch = {
+        .words = EVENT_VALUE_WORD_NUMBER,
+        .pValue = pEvtData->value,
+        .pTrigger = pEvtData->trigger,
+    };
+    os_memcpy(evt_sch.listen, pListen, sizeof(evt_sch.listen));
+
+    return _event_wait_invoke(ctx, &evt_sch, timeout_ms, NULL);
 }
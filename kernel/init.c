@@ -34,3 +34,181 @@ void init_static_thread_list(void)
         }
     }
 }
+
+/**
+ * Local slot resource
+ */
+static init_slot_t g_init_slot[INIT_SLOT_NUM] = {0u};
+
+/**
+ * @brief Get the object section range and the object size of the slot type.
+ *
+ * @param type The slot type.
+ * @param pBegin The pointer of the section begin address.
+ * @param pEnd The pointer of the section end address.
+ *
+ * @return The object size of the slot type.
+ */
+static u32_t _init_slot_range(u8_t type, u32_t *pBegin, u32_t *pEnd)
+{
+    u32_t begin = 0u;
+    u32_t end = 0u;
+    u32_t size = 0u;
+
+    switch (type) {
+    case INIT_SLOT_THREAD:
+        INIT_SECTION_FIRST(INIT_SECTION_OS_THREAD_LIST, begin);
+        INIT_SECTION_LAST(INIT_SECTION_OS_THREAD_LIST, end);
+        size = sizeof(thread_context_t);
+        break;
+    case INIT_SLOT_TIMER:
+        INIT_SECTION_FIRST(INIT_SECTION_OS_TIMER_LIST, begin);
+        INIT_SECTION_LAST(INIT_SECTION_OS_TIMER_LIST, end);
+        size = sizeof(timer_context_t);
+        break;
+    case INIT_SLOT_SEMAPHORE:
+        INIT_SECTION_FIRST(INIT_SECTION_OS_SEMAPHORE_LIST, begin);
+        INIT_SECTION_LAST(INIT_SECTION_OS_SEMAPHORE_LIST, end);
+        size = sizeof(semaphore_context_t);
+        break;
+    case INIT_SLOT_MUTEX:
+        INIT_SECTION_FIRST(INIT_SECTION_OS_MUTEX_LIST, begin);
+        INIT_SECTION_LAST(INIT_SECTION_OS_MUTEX_LIST, end);
+        size = sizeof(mutex_context_t);
+        break;
+    case INIT_SLOT_EVENT:
+        INIT_SECTION_FIRST(INIT_SECTION_OS_EVENT_LIST, begin);
+        INIT_SECTION_LAST(INIT_SECTION_OS_EVENT_LIST, end);
+        size = sizeof(event_context_t);
+        break;
+    case INIT_SLOT_QUEUE:
+        INIT_SECTION_FIRST(INIT_SECTION_OS_QUEUE_LIST, begin);
+        INIT_SECTION_LAST(INIT_SECTION_OS_QUEUE_LIST, end);
+        size = sizeof(queue_context_t);
+        break;
+    case INIT_SLOT_POOL:
+        INIT_SECTION_FIRST(INIT_SECTION_OS_POOL_LIST, begin);
+        INIT_SECTION_LAST(INIT_SECTION_OS_POOL_LIST, end);
+        size = sizeof(pool_context_t);
+        break;
+    case INIT_SLOT_PUBLISH:
+        INIT_SECTION_FIRST(INIT_SECTION_OS_PUBLISH_LIST, begin);
+        INIT_SECTION_LAST(INIT_SECTION_OS_PUBLISH_LIST, end);
+        size = sizeof(publish_context_t);
+        break;
+    case INIT_SLOT_SUBSCRIBE:
+        INIT_SECTION_FIRST(INIT_SECTION_OS_SUBSCRIBE_LIST, begin);
+        INIT_SECTION_LAST(INIT_SECTION_OS_SUBSCRIBE_LIST, end);
+        size = sizeof(subscribe_context_t);
+        break;
+    case INIT_SLOT_RWLOCK:
+        INIT_SECTION_FIRST(INIT_SECTION_OS_RWLOCK_LIST, begin);
+        INIT_SECTION_LAST(INIT_SECTION_OS_RWLOCK_LIST, end);
+        size = sizeof(rwlock_context_t);
+        break;
+    case INIT_SLOT_COND:
+        INIT_SECTION_FIRST(INIT_SECTION_OS_COND_LIST, begin);
+        INIT_SECTION_LAST(INIT_SECTION_OS_COND_LIST, end);
+        size = sizeof(cond_context_t);
+        break;
+    case INIT_SLOT_BARRIER:
+        INIT_SECTION_FIRST(INIT_SECTION_OS_BARRIER_LIST, begin);
+        INIT_SECTION_LAST(INIT_SECTION_OS_BARRIER_LIST, end);
+        size = sizeof(barrier_context_t);
+        break;
+    case INIT_SLOT_LATCH:
+        INIT_SECTION_FIRST(INIT_SECTION_OS_LATCH_LIST, begin);
+        INIT_SECTION_LAST(INIT_SECTION_OS_LATCH_LIST, end);
+        size = sizeof(latch_context_t);
+        break;
+    case INIT_SLOT_STREAM:
+        INIT_SECTION_FIRST(INIT_SECTION_OS_STREAM_LIST, begin);
+        INIT_SECTION_LAST(INIT_SECTION_OS_STREAM_LIST, end);
+        size = sizeof(stream_context_t);
+        break;
+    default:
+        break;
+    }
+
+    *pBegin = begin;
+    *pEnd = end;
+    return size;
+}
+
+/**
+ * @brief Build the free slot list from the object section, the lower address slot will be taken first.
+ *
+ * @param type The slot type.
+ */
+static void _init_slot_build(u8_t type)
+{
+    init_slot_t *pSlot = &g_init_slot[type];
+    u32_t begin = 0u;
+    u32_t end = 0u;
+    u32_t size = _init_slot_range(type, &begin, &end);
+
+    pSlot->built = true;
+    if (!size) {
+        return;
+    }
+
+    for (u32_t addr = end; (addr - begin) >= size;) {
+        addr -= size;
+        struct base_head *pHead = (struct base_head *)addr;
+        if (!pHead->cs) {
+            list_node_push(&pSlot->free_list, &pHead->free, LIST_HEAD);
+        }
+    }
+}
+
+/**
+ * @brief Take a free object slot in constant time, it must be called in the critical section.
+ *
+ * @param type The slot type.
+ *
+ * @return The pointer of the free object, or NULL when the section is exhausted.
+ */
+void *init_slot_take(u8_t type)
+{
+    if (type >= INIT_SLOT_NUM) {
+        return NULL;
+    }
+
+    init_slot_t *pSlot = &g_init_slot[type];
+    if (!pSlot->built) {
+        _init_slot_build(type);
+    }
+
+    list_node_t *pNode = list_node_pop(&pSlot->free_list, LIST_HEAD);
+    if (!pNode) {
+        return NULL;
+    }
+
+    // The object head is always the first member of the kernel object.
+    return (void *)CONTAINEROF(pNode, struct base_head, free);
+}
+
+/**
+ * @brief Give back the object slot in constant time, it must be called in the critical section after the object was cleaned.
+ *
+ * @param type The slot type.
+ * @param pHead The pointer of the object head.
+ */
+void init_slot_release(u8_t type, struct base_head *pHead)
+{
+    if (type >= INIT_SLOT_NUM) {
+        return;
+    }
+
+    if ((!pHead) || (pHead->cs)) {
+        return;
+    }
+
+    init_slot_t *pSlot = &g_init_slot[type];
+    if (!pSlot->built) {
+        // The slot will be picked up when the list is built.
+        return;
+    }
+
+    list_node_push(&pSlot->free_list, &pHead->free, LIST_HEAD);
+}
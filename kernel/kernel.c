@@ -31,11 +31,25 @@ typedef struct {
 
     list_t sch_pend_list;
 
-    list_t sch_entry_list;
+    list_t sch_wait_list;
 
-    list_t sch_exit_list;
+#if (THREAD_BUDGET_ENABLED)
+    /* The task that runs after the pending schedule, the budget is charged to it since the schedule request */
+    struct schedule_task *pChargeTask;
 
-    list_t sch_wait_list;
+    /* The budget charge is being updated, the nested priority update doesn't update it again */
+    b_t budget_updating;
+#endif
+
+#if (FPU_LAZY_SWITCH_ENABLED)
+    /* The task whose context is in the FPU registers */
+    struct schedule_task *pFpuOwner;
+
+    /* The owner was switched out and its context is left in the FPU registers */
+    b_t fpu_parked;
+
+    struct fpu_statistics fpu;
+#endif
 } _kernel_resource_t;
 
 /**
@@ -65,22 +79,31 @@ static b_t _schedule_priority_node_order_compare_condition(list_node_t *pCurNode
         return false;
     }
 
-    if (pCurTask->prior <= pExtractTask->prior) {
+    if (pCurTask->prior < pExtractTask->prior) {
         /* Find a right position and doesn't has to do schedule */
         return false;
     }
 
-    return true;
-}
+#if (THREAD_DEADLINE_ENABLED)
+    if (pCurTask->prior == pExtractTask->prior) {
+        /* The deadline tasks go first in the same priority, and the earlier absolute deadline goes first among them */
+        if (!pExtractTask->edf.enabled) {
+            return false;
+        }
 
-static void _schedule_transfer_toEntryList(linker_t *pLinker)
-{
-    ENTER_CRITICAL_SECTION();
+        if (!pCurTask->edf.enabled) {
+            return true;
+        }
 
-    list_t *pToList = (list_t *)&g_kernel_rsc.sch_entry_list;
-    linker_list_transaction_common(pLinker, pToList, LIST_TAIL);
+        return ((i32_t)(pCurTask->edf.abs_deadline_ms - pExtractTask->edf.abs_deadline_ms) >= 0) ? (true) : (false);
+    }
+#else
+    if (pCurTask->prior == pExtractTask->prior) {
+        return false;
+    }
+#endif
 
-    EXIT_CRITICAL_SECTION();
+    return true;
 }
 
 static void _schedule_transfer_toNullList(linker_t *pLinker)
@@ -108,16 +131,6 @@ static void _schedule_transfer_toTargetList(linker_t *pLinker, list_t *pToList)
     EXIT_CRITICAL_SECTION();
 }
 
-static void _schedule_transfer_toExitList(linker_t *pLinker)
-{
-    ENTER_CRITICAL_SECTION();
-
-    list_t *pToList = (list_t *)&g_kernel_rsc.sch_exit_list;
-    linker_list_transaction_specific(pLinker, pToList, _schedule_priority_node_order_compare_condition);
-
-    EXIT_CRITICAL_SECTION();
-}
-
 static void _schedule_transfer_toPendList(linker_t *pLinker)
 {
     ENTER_CRITICAL_SECTION();
@@ -140,92 +153,364 @@ static void _schedule_time_analyze(struct schedule_task *pFrom, struct schedule_
     pTo->exec.analyze.last_active_ms = ms;
 }
 
-static void _schedule_exit(u32_t ms)
+#if (THREAD_BUDGET_ENABLED)
+/**
+ * @brief Replenish the budget when its period passed, the missed periods are skipped in constant time.
+ *
+ * @param pBudget The pointer of the task budget.
+ * @param ms The current system time.
+ *
+ * @return The true indicates the budget is replenished.
+ */
+static b_t _schedule_budget_replenish(struct schedule_budget *pBudget, u32_t ms)
+{
+    i32_t late_ms = (i32_t)(ms - pBudget->replenish_ms);
+    if (late_ms < 0) {
+        return false;
+    }
+
+    pBudget->remaining_us = pBudget->budget_us;
+    pBudget->exhausted = false;
+    pBudget->replenish_ms += (((u32_t)late_ms / pBudget->period_ms) + 1u) * pBudget->period_ms;
+    return true;
+}
+
+/**
+ * @brief Stop charging the task, and throttle it when the budget is exhausted.
+ *
+ * @param pTask The pointer of the task that stops running.
+ * @param us The current system time (us).
+ * @param ms The current system time (ms).
+ */
+static void _schedule_budget_charge(struct schedule_task *pTask, u32_t us, u32_t ms)
+{
+    struct schedule_budget *pBudget = &pTask->budget;
+    if ((!pBudget->enabled) || (pBudget->throttled)) {
+        return;
+    }
+
+    u32_t used_us = us - pBudget->dispatch_us;
+    pBudget->remaining_us = (used_us < pBudget->remaining_us) ? (pBudget->remaining_us - used_us) : (0u);
+    timeout_remove(&pBudget->expire, true);
+    _schedule_budget_replenish(pBudget, ms);
+
+    if ((pBudget->remaining_us) && (!pBudget->exhausted)) {
+        return;
+    }
+
+    /* The task runs in the background until the replenishment, the priority that it inherited from the mutex waiters is kept */
+    pBudget->exhausted = false;
+    pBudget->throttled = true;
+    pBudget->throttles++;
+    mutex_priority_recalculate(pTask);
+    timeout_set(&pBudget->expire, (pBudget->replenish_ms - ms), true);
+}
+
+/**
+ * @brief Start charging the task, the budget timer is armed with the remaining budget.
+ *
+ * @param pTask The pointer of the task that starts running.
+ * @param us The current system time (us).
+ * @param ms The current system time (ms).
+ */
+static void _schedule_budget_dispatch(struct schedule_task *pTask, u32_t us, u32_t ms)
 {
-    b_t need = false;
-    struct schedule_task *pCurTask = NULL;
+    struct schedule_budget *pBudget = &pTask->budget;
+    if ((!pBudget->enabled) || (pBudget->throttled)) {
+        return;
+    }
+
+    _schedule_budget_replenish(pBudget, ms);
+    pBudget->dispatch_us = us;
+    timeout_set(&pBudget->expire, ((pBudget->remaining_us + 999u) / 1000u), true);
+}
+#endif
+
+b_t _schedule_can_preempt(struct schedule_task *pCurrent)
+{
+    struct schedule_task *pTmpTask = NULL;
     list_iterator_t it = ITERATION_NULL;
-    list_t *pList = (list_t *)&g_kernel_rsc.sch_exit_list;
+    list_t *pList = (list_t *)&g_kernel_rsc.sch_pend_list;
 
     list_iterator_init(&it, pList);
-    while (list_iterator_next_condition(&it, (void *)&pCurTask)) {
-        struct call_exit *pExit = &pCurTask->exec.exit;
-
-        if (pExit->timeout_ms) {
-            timeout_set(&pCurTask->expire, pExit->timeout_ms, false);
-            if (pExit->timeout_ms != OS_TIME_FOREVER_VAL) {
-                need = true;
-            }
+    while (list_iterator_next_condition(&it, (void *)&pTmpTask)) {
+        if (pTmpTask->prior >= 0) {
+            break;
         }
-        if (pExit->pToList) {
-            _schedule_transfer_toTargetList((linker_t *)&pCurTask->linker, (list_t *)pExit->pToList);
-        } else {
-            thread_context_t *pDelThread = (thread_context_t *)CONTAINEROF(pCurTask, thread_context_t, task);
-
-            _schedule_transfer_toNullList((linker_t *)&pCurTask->linker);
-            os_memset((char_t *)pDelThread->pStackAddr, STACT_UNUSED_DATA, pDelThread->stackSize);
-            os_memset((char_t *)pDelThread, 0x0u, sizeof(thread_context_t));
+
+        if (pTmpTask == pCurrent) {
+            return false;
         }
 
-        os_memset(pExit, 0x0, sizeof(struct call_exit));
-        pCurTask->exec.entry.result = PC_EOR;
+        if (pTmpTask->prior == OS_PRIOTITY_HIGHEST_LEVEL) {
+            break;
+        }
     }
 
-    if (need) {
-        timer_schedule();
-    }
+    return true;
 }
 
-static void _schedule_entry(u32_t ms)
+#if (THREAD_BUDGET_ENABLED)
+/**
+ * @brief Move the budget charge to the task that runs after the pending schedule. It's done at the trigger time, so the PendSV doesn't
+ * touch the timer list, and the charged time differs from the running time by the PendSV latency only.
+ */
+static void _schedule_budget_update(void)
 {
-    struct schedule_task *pCurTask = NULL;
-    list_iterator_t it = ITERATION_NULL;
-    list_t *pList = (list_t *)&g_kernel_rsc.sch_entry_list;
+    struct schedule_task *pCurrent = g_kernel_rsc.pTask;
+    if ((!pCurrent) || (g_kernel_rsc.budget_updating)) {
+        return;
+    }
+    g_kernel_rsc.budget_updating = true;
 
-    list_iterator_init(&it, pList);
-    while (list_iterator_next_condition(&it, (void *)&pCurTask)) {
-        struct call_entry *pEntry = &pCurTask->exec.entry;
-        if (pEntry->fun) {
-            pEntry->fun(pCurTask);
-            pEntry->fun = NULL;
+    while (1) {
+        /* The same choice as the PendSV makes */
+        struct schedule_task *pNext = (_schedule_can_preempt(pCurrent)) ? (_schedule_nextTaskGet()) : (pCurrent);
+        struct schedule_task *pCharge = g_kernel_rsc.pChargeTask;
+        if ((pNext == pCharge) && (!pCharge->budget.exhausted)) {
+            break;
         }
-        pCurTask->pPendCtx = NULL;
-        pCurTask->exec.analyze.last_pend_ms = ms;
 
-        _schedule_transfer_toPendList((linker_t *)&pCurTask->linker);
+        /* The throttling changes the priority order, the choice is made again */
+        u32_t us = timer_total_system_us_get();
+        u32_t ms = timer_total_system_ms_get();
+        if (pCharge) {
+            _schedule_budget_charge(pCharge, us, ms);
+        }
+        _schedule_budget_dispatch(pNext, us, ms);
+        g_kernel_rsc.pChargeTask = pNext;
     }
+
+    g_kernel_rsc.budget_updating = false;
 }
+#endif
 
-i32p_t schedule_exit_trigger(struct schedule_task *pTask, void *pHoldCtx, void *pHoldData, list_t *pToList, u32_t timeout_ms,
-                             b_t immediately)
+/**
+ * @brief Leave the FPU context in the registers at the switch, the FPU access is granted to its owner only.
+ *
+ * @param pFrom The pointer of the task that's switched out.
+ * @param pTo The pointer of the task that's switched in.
+ */
+static void _schedule_fpu_dispatch(struct schedule_task *pFrom, struct schedule_task *pTo)
 {
-    pTask->pPendCtx = pHoldCtx;
-    pTask->pPendData = pHoldData;
+#if (FPU_LAZY_SWITCH_ENABLED)
+    g_kernel_rsc.fpu.switches++;
+    if (pFrom->fpu.used) {
+        g_kernel_rsc.fpu.deferred++;
+    }
+
+    if (g_kernel_rsc.pFpuOwner == pFrom) {
+        g_kernel_rsc.fpu_parked = true;
+    } else if ((g_kernel_rsc.pFpuOwner == pTo) && (g_kernel_rsc.fpu_parked)) {
+        /* No one took the FPU while the owner was switched out, its context was neither saved nor restored */
+        g_kernel_rsc.fpu_parked = false;
+        g_kernel_rsc.fpu.avoided++;
+    }
+
+    port_fpu_access_set((g_kernel_rsc.pFpuOwner == pTo) ? (true) : (false));
+#else
+    UNUSED_MSG(pFrom);
+    UNUSED_MSG(pTo);
+#endif
+}
+
+/**
+ * @brief Record the wake-to-run latency when the woken task starts running, it takes a constant time.
+ *
+ * @param pTo The pointer of the task that's switched in.
+ */
+static void _schedule_latency_analyze(struct schedule_task *pTo)
+{
+#if (TRACE_SCHEDULE_LATENCY_ENABLED)
+    struct call_latency *pLatency = &pTo->exec.latency;
+    if (!pLatency->pending) {
+        return;
+    }
+    pLatency->pending = false;
+
+    u32_t us = timer_total_system_us_get() - pLatency->wake_us;
+    if ((!pLatency->count) || (us < pLatency->min_us)) {
+        pLatency->min_us = us;
+    }
+    if (us > pLatency->max_us) {
+        pLatency->max_us = us;
+    }
+    pLatency->count++;
+    pLatency->histogram[trace_histogram_bucket(us, TRACE_SCHEDULE_LATENCY_BUCKET_NUMBER)]++;
+#else
+    UNUSED_MSG(pTo);
+#endif
+}
+
+/**
+ * @brief Move the task out of the pending list, the work is done at the trigger time rather than in the PendSV.
+ *
+ * @param pTask The pointer of the task.
+ * @param pToList The pointer of the target list, the NULL indicates the thread is deleted.
+ * @param timeout_ms The timeout of the task waiting.
+ */
+static void _schedule_exit(struct schedule_task *pTask, list_t *pToList, u32_t timeout_ms)
+{
+    timeout_set(&pTask->expire, timeout_ms, true);
+#if (TRACE_CONTENTION_ENABLED)
+    pTask->exec.entry.block_us = timer_total_system_us_get();
+#endif
+
+#if (TRACE_SCHEDULE_LATENCY_ENABLED)
+    pTask->exec.latency.pending = false;
+#endif
 
-    if (immediately) {
-        timeout_set(&pTask->expire, timeout_ms, true);
+    if (pToList) {
         _schedule_transfer_toTargetList((linker_t *)&pTask->linker, pToList);
     } else {
-        pTask->exec.exit.pToList = pToList;
-        pTask->exec.exit.timeout_ms = timeout_ms;
-        _schedule_transfer_toExitList((linker_t *)&pTask->linker);
+        thread_context_t *pDelThread = (thread_context_t *)CONTAINEROF(pTask, thread_context_t, task);
+
+#if (THREAD_BUDGET_ENABLED)
+        timeout_remove(&pTask->budget.expire, true);
+        if (g_kernel_rsc.pChargeTask == pTask) {
+            g_kernel_rsc.pChargeTask = NULL;
+        }
+#endif
+#if (FPU_LAZY_SWITCH_ENABLED)
+        if (g_kernel_rsc.pFpuOwner == pTask) {
+            /* The FPU registers don't belong to anyone, the next trap doesn't save them */
+            g_kernel_rsc.pFpuOwner = NULL;
+            g_kernel_rsc.fpu_parked = false;
+        }
+#endif
+        _schedule_transfer_toNullList((linker_t *)&pTask->linker);
+        os_memset((char_t *)pDelThread->pStackAddr, STACT_UNUSED_DATA, pDelThread->stackSize);
+        os_memset((char_t *)pDelThread, 0x0u, sizeof(thread_context_t));
+        init_slot_release(INIT_SLOT_THREAD, &pDelThread->head);
     }
-    return kernel_thread_schedule_request();
 }
 
-i32p_t schedule_entry_trigger(struct schedule_task *pTask, pTask_callbackFunc_t callback, u32_t result)
+/**
+ * @brief Move the task into the pending list, the work is done at the trigger time rather than in the PendSV.
+ *
+ * @param pTask The pointer of the task.
+ * @param result The wake up result of the task.
+ * @param ms The current system time.
+ */
+static void _schedule_entry(struct schedule_task *pTask, u32_t result, u32_t ms)
 {
     pTask->exec.entry.result = result;
-    pTask->exec.entry.fun = callback;
-    _schedule_transfer_toEntryList((linker_t *)&pTask->linker);
+    pTask->pPendCtx = NULL;
+    pTask->pPendTimeoutFunc = NULL;
+    pTask->exec.analyze.last_pend_ms = ms;
+
+#if (TRACE_CONTENTION_ENABLED) || (TRACE_SCHEDULE_LATENCY_ENABLED)
+    u32_t us = timer_total_system_us_get();
+#endif
+
+#if (TRACE_CONTENTION_ENABLED)
+    pTask->exec.entry.wait_us = us - pTask->exec.entry.block_us;
+#endif
+
+#if (TRACE_SCHEDULE_LATENCY_ENABLED)
+    if (!pTask->exec.latency.pending) {
+        pTask->exec.latency.wake_us = us;
+        pTask->exec.latency.pending = true;
+    }
+#endif
+
+    _schedule_transfer_toPendList((linker_t *)&pTask->linker);
+}
+
+i32p_t schedule_exit_trigger(struct schedule_task *pTask, void *pHoldCtx, void *pHoldData, list_t *pToList, u32_t timeout_ms)
+{
+    pTask->pPendCtx = pHoldCtx;
+    pTask->pPendData = pHoldData;
+    pTask->pPendTimeoutFunc = NULL;
+
+    _schedule_exit(pTask, pToList, timeout_ms);
+    return kernel_thread_schedule_request();
+}
+
+i32p_t schedule_entry_trigger(struct schedule_task *pTask, u32_t result)
+{
+    _schedule_entry(pTask, result, timer_total_system_ms_get());
+    return kernel_thread_schedule_request();
+}
+
+/**
+ * @brief Wake up all tasks of the waiting list and request the schedule once.
+ *
+ * @param pList The pointer of the waiting list.
+ * @param result The wake up result of the tasks.
+ *
+ * @return The result of the schedule request.
+ */
+i32p_t schedule_entry_all_trigger(list_t *pList, u32_t result)
+{
+    u32_t ms = timer_total_system_ms_get();
+
+    struct schedule_task *pTask = (struct schedule_task *)list_head(pList);
+    while (pTask) {
+        /* The task take the result, its timeout can't override it any more */
+        timeout_remove(&pTask->expire, true);
+        _schedule_entry(pTask, result, ms);
+
+        pTask = (struct schedule_task *)list_head(pList);
+    }
     return kernel_thread_schedule_request();
 }
 
+/**
+ * @brief Set the function that the pending object calls when the task times out, it's cleared when the task is woken up.
+ *
+ * @param pTask The pointer of the task that was just blocked.
+ * @param pFunc The timeout function of the pending object.
+ */
+void schedule_pend_timeout_set(struct schedule_task *pTask, pTimeout_callbackFunc_t pFunc)
+{
+    pTask->pPendTimeoutFunc = pFunc;
+}
+
 void schedule_callback_fromTimeOut(void *pNode)
 {
     struct schedule_task *pCurTask = (struct schedule_task *)CONTAINEROF(pNode, struct schedule_task, expire);
-    schedule_entry_trigger(pCurTask, NULL, PC_OS_WAIT_TIMEOUT);
+    pTimeout_callbackFunc_t pPendTimeoutFunc = pCurTask->pPendTimeoutFunc;
+    void *pPendCtx = pCurTask->pPendCtx;
+
+    schedule_entry_trigger(pCurTask, PC_OS_WAIT_TIMEOUT);
+    if (pPendTimeoutFunc) {
+        /* The task has left the pending list, the object recovers without it in the same critical section */
+        pPendTimeoutFunc(pPendCtx);
+    }
+}
+
+#if (THREAD_BUDGET_ENABLED)
+/**
+ * @brief The budget timer callback, the exhausted task is throttled by the schedule request.
+ *
+ * @param pNode The pointer of the budget timer node.
+ */
+void schedule_callback_fromBudget(void *pNode)
+{
+    struct schedule_task *pCurTask = (struct schedule_task *)CONTAINEROF(pNode, struct schedule_task, budget.expire);
+    struct schedule_budget *pBudget = &pCurTask->budget;
+
+    if (pBudget->throttled) {
+        /* The replenishment restores the throttled task */
+        pBudget->throttled = false;
+        if (!_schedule_budget_replenish(pBudget, timer_total_system_ms_get())) {
+            // The clock expired ahead of the millisecond boundary.
+            pBudget->remaining_us = pBudget->budget_us;
+            pBudget->replenish_ms += pBudget->period_ms;
+        }
+        mutex_priority_recalculate(pCurTask);
+
+        if (g_kernel_rsc.pChargeTask == pCurTask) {
+            /* It was running in the background without the charge */
+            g_kernel_rsc.pChargeTask = NULL;
+        }
+    } else {
+        pBudget->exhausted = true;
+    }
+    kernel_thread_schedule_request();
 }
+#endif
 
 b_t schedule_hasTwoPendingItem(void)
 {
@@ -249,35 +534,122 @@ void schedule_setPend(struct schedule_task *pTask)
     EXIT_CRITICAL_SECTION();
 }
 
-list_t *schedule_waitList(void)
+/**
+ * @brief Change the task priority and keep the priority order of the list where the task stays.
+ *
+ * @param pTask The pointer of the task.
+ * @param priority The new priority.
+ */
+void schedule_priority_update(struct schedule_task *pTask, i16_t priority)
 {
-    return (list_t *)&g_kernel_rsc.sch_wait_list;
+    ENTER_CRITICAL_SECTION();
+
+    pTask->prior = priority;
+
+    list_t *pList = pTask->linker.pList;
+    if (pList) {
+        linker_list_transaction_specific((linker_t *)&pTask->linker, pList, _schedule_priority_node_order_compare_condition);
+    }
+#if (THREAD_BUDGET_ENABLED)
+    _schedule_budget_update();
+#endif
+
+    EXIT_CRITICAL_SECTION();
 }
 
-b_t _schedule_can_preempt(struct schedule_task *pCurrent)
+/**
+ * @brief Get the task priority without the mutex inheritance, the throttled task runs at the lowest application priority.
+ *
+ * @param pTask The pointer of the task.
+ *
+ * @return The base priority.
+ */
+i16_t schedule_priority_base(struct schedule_task *pTask)
+{
+#if (THREAD_BUDGET_ENABLED)
+    if (pTask->budget.throttled) {
+        return MAX_AB(pTask->base_prior, OS_PRIORITY_APPLICATION_LOWEST_LEVEL);
+    }
+#endif
+
+    return pTask->base_prior;
+}
+
+#if (THREAD_BUDGET_ENABLED)
+/**
+ * @brief Set the task execution budget, the task is charged again from the next schedule request.
+ *
+ * @param pTask The pointer of the task.
+ * @param budget_us The execution budget in each period, the value 0 removes the limitation.
+ * @param period_ms The replenishment period.
+ */
+void schedule_budget_set(struct schedule_task *pTask, u32_t budget_us, u32_t period_ms)
+{
+    struct schedule_budget *pBudget = &pTask->budget;
+    b_t throttled = pBudget->throttled;
+
+    timeout_remove(&pBudget->expire, true);
+    pBudget->enabled = (budget_us) ? (true) : (false);
+    pBudget->throttled = false;
+    pBudget->exhausted = false;
+    pBudget->budget_us = budget_us;
+    pBudget->period_ms = period_ms;
+    pBudget->remaining_us = budget_us;
+    pBudget->replenish_ms = timer_total_system_ms_get() + period_ms;
+    pBudget->throttles = 0u;
+
+    if (throttled) {
+        mutex_priority_recalculate(pTask);
+    }
+
+    if (g_kernel_rsc.pChargeTask == pTask) {
+        g_kernel_rsc.pChargeTask = NULL;
+    }
+}
+#endif
+
+/**
+ * @brief Put the task behind the ready target task of the same priority, the target runs ahead of it at the next schedule.
+ *
+ * @param pTask The pointer of the task.
+ * @param pTarget The pointer of the target task.
+ *
+ * @return The true indicates the task is put behind the target task.
+ */
+b_t schedule_yield_to(struct schedule_task *pTask, struct schedule_task *pTarget)
 {
-    struct schedule_task *pTmpTask = NULL;
-    list_iterator_t it = ITERATION_NULL;
     list_t *pList = (list_t *)&g_kernel_rsc.sch_pend_list;
 
-    list_iterator_init(&it, pList);
-    while (list_iterator_next_condition(&it, (void *)&pTmpTask)) {
-        if (pTmpTask->prior >= 0) {
-            break;
-        }
+    if ((pTask->linker.pList != pList) || (pTarget->linker.pList != pList)) {
+        return false;
+    }
 
-        if (pTmpTask == pCurrent) {
-            return false;
-        }
+    if (pTask->prior != pTarget->prior) {
+        // The lower priority target doesn't run before the task gives up, and the higher one is running already.
+        return false;
+    }
 
-        if (pTmpTask->prior == OS_PRIOTITY_HIGHEST_LEVEL) {
-            break;
-        }
+#if (THREAD_DEADLINE_ENABLED)
+    if ((pTask->edf.enabled) || (pTarget->edf.enabled)) {
+        // The deadline order is kept.
+        return false;
     }
+#endif
 
+    list_node_delete(pList, &pTask->linker.node);
+    if (pTarget->linker.node.pNext) {
+        list_node_insertBefore(pList, pTarget->linker.node.pNext, &pTask->linker.node);
+    } else {
+        list_node_push(pList, &pTask->linker.node, LIST_TAIL);
+    }
     return true;
 }
 
+list_t *schedule_waitList(void)
+{
+    return (list_t *)&g_kernel_rsc.sch_wait_list;
+}
+
 /**
  * @brief kernel schedule in PendSV interrupt content.
  *
@@ -288,9 +660,7 @@ void kernel_scheduler_inPendSV_c(u32_t **ppCurPsp, u32_t **ppNextPSP)
 {
     u32_t ms = timer_total_system_ms_get();
 
-    _schedule_exit(ms);
-    _schedule_entry(ms);
-
+    /* The entry and exit work and the budget charge have been done at the trigger time, it only picks the next task here */
     struct schedule_task *pCurrent = g_kernel_rsc.pTask;
     struct schedule_task *pNext = _schedule_nextTaskGet();
 
@@ -299,6 +669,8 @@ void kernel_scheduler_inPendSV_c(u32_t **ppCurPsp, u32_t **ppNextPSP)
         *ppNextPSP = (u32_t *)&pNext->psp;
 
         _schedule_time_analyze(pCurrent, pNext, ms);
+        _schedule_latency_analyze(pNext);
+        _schedule_fpu_dispatch(pCurrent, pNext);
         g_kernel_rsc.pTask = pNext;
         g_kernel_rsc.pendsv_ms = ms;
     } else {
@@ -344,6 +716,9 @@ static i32p_t _kernel_start_privilege_routine(arguments_t *pArgs)
 
     g_kernel_rsc.pTask = _schedule_nextTaskGet();
     g_kernel_rsc.run = true;
+#if (THREAD_BUDGET_ENABLED)
+    _schedule_budget_update();
+#endif
 
     EXIT_CRITICAL_SECTION();
 
@@ -423,6 +798,9 @@ i32p_t kernel_thread_schedule_request(void)
         return PC_EOR;
     }
 
+#if (THREAD_BUDGET_ENABLED)
+    _schedule_budget_update();
+#endif
     _kernel_setPendSV();
     return 0;
 }
@@ -530,3 +908,54 @@ i32p_t _impl_kernel_at_rtos_run(void)
 
     return kernel_privilege_invoke((const void *)_kernel_start_privilege_routine, NULL);
 }
+
+/**
+ * @brief Move the FPU ownership to the running task, the port calls it in the UsageFault when the task executed a floating point
+ * instruction without the FPU access. The access is granted before it's called.
+ */
+void kernel_fpu_trap_handler(void)
+{
+#if (FPU_LAZY_SWITCH_ENABLED)
+    struct schedule_task *pCurTask = g_kernel_rsc.pTask;
+    struct schedule_task *pOwner = g_kernel_rsc.pFpuOwner;
+
+    if (pOwner == pCurTask) {
+        return;
+    }
+
+    if (pOwner) {
+        port_fpu_context_save(pOwner->fpu.regs);
+        g_kernel_rsc.fpu.saves++;
+    }
+    g_kernel_rsc.fpu_parked = false;
+    port_fpu_context_restore(pCurTask->fpu.regs);
+
+    pCurTask->fpu.used = true;
+    pCurTask->fpu.traps++;
+    g_kernel_rsc.pFpuOwner = pCurTask;
+#endif
+}
+
+/**
+ * @brief Take the lazy FPU context switch statistics snapshot.
+ *
+ * @param pStatistics The pointer of the FPU statistics.
+ *
+ * @return The result of the operation.
+ */
+i32p_t _impl_kernel_fpu_statistics_get(struct fpu_statistics *pStatistics)
+{
+#if (FPU_LAZY_SWITCH_ENABLED)
+    if (!pStatistics) {
+        return PC_EOR;
+    }
+
+    ENTER_CRITICAL_SECTION();
+    *pStatistics = g_kernel_rsc.fpu;
+    EXIT_CRITICAL_SECTION();
+    return 0;
+#else
+    UNUSED_MSG(pStatistics);
+    return PC_EOR;
+#endif
+}
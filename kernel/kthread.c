@@ -14,6 +14,11 @@ INIT_OS_THREAD_RUNTIME_NUM_DEFINE(THREAD_RUNTIME_NUMBER_SUPPORTED);
 INIT_OS_TIMER_RUNTIME_NUM_DEFINE(TIMER_RUNTIME_NUMBER_SUPPORTED);
 INIT_OS_SEM_RUNTIME_NUM_DEFINE(SEMAPHORE_RUNTIME_NUMBER_SUPPORTED);
 INIT_OS_MUTEX_RUNTIME_NUM_DEFINE(MUTEX_RUNTIME_NUMBER_SUPPORTED);
+INIT_OS_RWLOCK_RUNTIME_NUM_DEFINE(RWLOCK_RUNTIME_NUMBER_SUPPORTED);
+INIT_OS_COND_RUNTIME_NUM_DEFINE(COND_RUNTIME_NUMBER_SUPPORTED);
+INIT_OS_BARRIER_RUNTIME_NUM_DEFINE(BARRIER_RUNTIME_NUMBER_SUPPORTED);
+INIT_OS_LATCH_RUNTIME_NUM_DEFINE(LATCH_RUNTIME_NUMBER_SUPPORTED);
+INIT_OS_STREAM_RUNTIME_NUM_DEFINE(STREAM_RUNTIME_NUMBER_SUPPORTED);
 INIT_OS_EVT_RUNTIME_NUM_DEFINE(EVENT_RUNTIME_NUMBER_SUPPORTED);
 INIT_OS_MSGQ_RUNTIME_NUM_DEFINE(QUEUE_RUNTIME_NUMBER_SUPPORTED);
 INIT_OS_POOL_RUNTIME_NUM_DEFINE(POOL_RUNTIME_NUMBER_SUPPORTED);
@@ -37,13 +42,26 @@ const at_rtos_api_t os = {
     .thread_suspend = os_thread_suspend,
     .thread_yield = os_thread_yield,
     .thread_delete = os_thread_delete,
+    .thread_deadline_set = os_thread_deadline_set,
+    .thread_deadline_wait = os_thread_deadline_wait,
+    .thread_budget_set = os_thread_budget_set,
     .thread_idle_fn_register = os_thread_idle_callback_register,
 
+    .coroutine_add = os_coroutine_add,
+    .coroutine_group_run = os_coroutine_group_run,
+    .coroutine_notify = os_coroutine_notify,
+
+    .rtc_task_add = os_rtc_task_add,
+    .rtc_post = os_rtc_post,
+
     .timer_init = os_timer_init,
     .timer_automatic = os_timer_automatic,
     .timer_start = os_timer_start,
     .timer_stop = os_timer_stop,
     .timer_busy = os_timer_busy,
+    .timer_slack_set = os_timer_slack_set,
+    .timer_overrun_get = os_timer_overrun_get,
+    .timer_statistics_get = os_timer_statistics_get,
     .timer_system_total_ms = os_timer_system_total_ms,
 
     .sem_init = os_sem_init,
@@ -54,14 +72,49 @@ const at_rtos_api_t os = {
     .mutex_init = os_mutex_init,
     .mutex_lock = os_mutex_lock,
     .mutex_unlock = os_mutex_unlock,
+    .mutex_recursive_init = os_mutex_recursive_init,
+    .mutex_lock_timeout = os_mutex_lock_timeout,
+    .mutex_adaptive_init = os_mutex_adaptive_init,
+    .mutex_statistics_get = os_mutex_statistics_get,
+
+    .rwlock_init = os_rwlock_init,
+    .rwlock_read_lock = os_rwlock_read_lock,
+    .rwlock_read_unlock = os_rwlock_read_unlock,
+    .rwlock_write_lock = os_rwlock_write_lock,
+    .rwlock_write_unlock = os_rwlock_write_unlock,
+
+    .cond_init = os_cond_init,
+    .cond_wait = os_cond_wait,
+    .cond_signal = os_cond_signal,
+    .cond_broadcast = os_cond_broadcast,
+
+    .barrier_init = os_barrier_init,
+    .barrier_wait = os_barrier_wait,
+    .latch_init = os_latch_init,
+    .latch_count_down = os_latch_count_down,
+    .latch_wait = os_latch_wait,
+    .latch_count_get = os_latch_count_get,
 
     .evt_init = os_evt_init,
     .evt_set = os_evt_set,
     .evt_wait = os_evt_wait,
+    .evt_wide_init = os_evt_wide_init,
+    .evt_wide_value_get = os_evt_wide_value_get,
+    .evt_wide_set = os_evt_wide_set,
+    .evt_wide_wait = os_evt_wide_wait,
 
     .msgq_init = os_msgq_init,
     .msgq_put = os_msgq_put,
     .msgq_get = os_msgq_get,
+    .msgq_priority_init = os_msgq_priority_init,
+    .msgq_priority_put = os_msgq_priority_put,
+
+    .stream_init = os_stream_init,
+    .msgbuf_init = os_msgbuf_init,
+    .stream_send = os_stream_send,
+    .stream_receive = os_stream_receive,
+    .stream_peek = os_stream_peek,
+    .stream_consume = os_stream_consume,
 
     .pool_init = os_pool_init,
     .pool_take = os_pool_take,
@@ -84,6 +137,15 @@ const at_rtos_api_t os = {
     .trace_postcode = os_trace_failed_postcode,
     .trace_thread = os_trace_foreach_thread,
     .trace_time = os_trace_analyze,
+    .trace_deadline = os_trace_foreach_deadline,
+    .trace_fpu = os_trace_fpu_statistics_get,
+    .trace_mutex = os_trace_foreach_mutex,
+    .trace_sem = os_trace_foreach_sem,
+    .trace_msgq = os_trace_foreach_msgq,
+    .trace_thread_latency = os_trace_thread_latency,
+    .trace_thread_latency_reset = os_trace_thread_latency_reset,
+    .trace_critical_section = os_trace_critical_section,
+    .trace_critical_section_reset = os_trace_critical_section_reset,
 };
 #endif
 
@@ -44,42 +44,237 @@ static b_t _mutex_context_isInit(mutex_context_t *pCurMutex)
 }
 
 /**
- * @brief It's sub-routine running at privilege mode.
+ * @brief Get the mutex that the task is blocked on.
  *
- * @param pArgs The function argument packages.
+ * @param pTask The pointer of the task.
  *
- * @return The result of privilege routine.
+ * @return The pointer of the mutex, or NULL when the task isn't blocked on a mutex.
  */
-static u32_t _mutex_init_privilege_routine(arguments_t *pArgs)
+static mutex_context_t *_mutex_blocked_on(struct schedule_task *pTask)
 {
-    ENTER_CRITICAL_SECTION();
+    mutex_context_t *pCurMutex = (mutex_context_t *)pTask->pPendCtx;
+    if (_mutex_context_isInvalid(pCurMutex)) {
+        return NULL;
+    }
 
-    const char_t *pName = (const char_t *)(pArgs[0].pch_val);
+    if (!_mutex_context_isInit(pCurMutex)) {
+        return NULL;
+    }
 
-    INIT_SECTION_FOREACH(INIT_SECTION_OS_MUTEX_LIST, mutex_context_t, pCurMutex)
-    {
-        if (_mutex_context_isInvalid(pCurMutex)) {
+    if (pTask->linker.pList != &pCurMutex->q_list) {
+        return NULL;
+    }
+
+    return pCurMutex;
+}
+
+/**
+ * @brief Give the mutex ownership to the task and record it in the task held list.
+ *
+ * @param pCurMutex The pointer of the mutex.
+ * @param pTask The pointer of the new hold task.
+ */
+static void _mutex_hold(mutex_context_t *pCurMutex, struct schedule_task *pTask)
+{
+    pCurMutex->pHoldTask = pTask;
+    pCurMutex->locked = true;
+    list_node_push(&pTask->held_list, &pCurMutex->held_node, LIST_HEAD);
+}
+
+/**
+ * @brief Boost the hold task priority and walk through the chain of the holders which blocked on another mutex.
+ *
+ * @param pCurMutex The pointer of the mutex that the new waiter blocked on.
+ * @param priority The priority of the new waiter.
+ */
+static void _mutex_inheritance_propagate(mutex_context_t *pCurMutex, i16_t priority)
+{
+    while ((pCurMutex) && (pCurMutex->locked)) {
+        struct schedule_task *pHoldTask = pCurMutex->pHoldTask;
+        if (pHoldTask->prior <= priority) {
+            // The chain already runs at the higher priority, it also stops the deadlock loop.
             break;
         }
+        schedule_priority_update(pHoldTask, priority);
+        pCurMutex = _mutex_blocked_on(pHoldTask);
+    }
+}
+
+/**
+ * @brief Recalculate the task priority from the waiters of its held mutexes and walk through the chain of the holders.
+ *
+ * @param pTask The pointer of the task.
+ */
+static void _mutex_inheritance_recalculate(struct schedule_task *pTask)
+{
+    while (pTask) {
+        i16_t priority = schedule_priority_base(pTask);
+        list_iterator_t it = ITERATION_NULL;
+        list_node_t *pNode = NULL;
+
+        list_iterator_init(&it, &pTask->held_list);
+        while (list_iterator_next_condition(&it, &pNode)) {
+            mutex_context_t *pHeldMutex = (mutex_context_t *)CONTAINEROF(pNode, mutex_context_t, held_node);
+            struct schedule_task *pWaitTask = (struct schedule_task *)list_head(&pHeldMutex->q_list);
+            if ((pWaitTask) && (pWaitTask->prior < priority)) {
+                priority = pWaitTask->prior;
+            }
+        }
 
-        if (_mutex_context_isInit(pCurMutex)) {
-            continue;
+        if (pTask->prior == priority) {
+            break;
         }
+        schedule_priority_update(pTask, priority);
 
-        os_memset((char_t *)pCurMutex, 0x0u, sizeof(mutex_context_t));
-        pCurMutex->head.cs = CS_INITED;
-        pCurMutex->head.pName = pName;
+        mutex_context_t *pBlockedMutex = _mutex_blocked_on(pTask);
+        pTask = (pBlockedMutex) ? (pBlockedMutex->pHoldTask) : (NULL);
+    }
+}
 
-        pCurMutex->locked = false;
+/**
+ * @brief The waiter timed out and left the q_list, the hold task drops the priority that it inherited from the waiter.
+ *
+ * @param pCtx The pointer of the mutex.
+ */
+static void _mutex_pend_timeout(void *pCtx)
+{
+    mutex_context_t *pCurMutex = (mutex_context_t *)pCtx;
+
+    if (pCurMutex->locked) {
+        _mutex_inheritance_recalculate(pCurMutex->pHoldTask);
+    }
+}
+
+/**
+ * @brief Release the mutex to the highest priority waiter and recover the priority of the hold task.
+ *
+ * @param pCurMutex The pointer of the locked mutex.
+ *
+ * @return The result of the operation.
+ */
+static i32p_t _mutex_release(mutex_context_t *pCurMutex)
+{
+    struct schedule_task *pCurTask = (struct schedule_task *)list_head(&pCurMutex->q_list);
+    struct schedule_task *pLockTask = pCurMutex->pHoldTask;
+    i32p_t postcode = 0;
+
+    list_node_delete(&pLockTask->held_list, &pCurMutex->held_node);
+
+    if (!pCurTask) {
+        // no blocking thread
         pCurMutex->pHoldTask = NULL;
-        pCurMutex->originalPriority = OS_PRIOTITY_INVALID_LEVEL;
+        pCurMutex->locked = false;
+    } else {
+        /* The highest priority waiter take the ticket, its timeout can't override the result any more */
+        timeout_remove(&pCurTask->expire, true);
+        postcode = schedule_entry_trigger(pCurTask, 0u);
+        _mutex_hold(pCurMutex, pCurTask);
+        trace_contention_acquire(&pCurMutex->contention, pCurTask);
+        _mutex_inheritance_recalculate(pCurTask);
+    }
+
+    /* priority recovery from the remaining held mutexes */
+    _mutex_inheritance_recalculate(pLockTask);
+    return postcode;
+}
+
+#if (THREAD_BUDGET_ENABLED)
+/**
+ * @brief Recalculate the task priority when its own priority is changed by the budget throttling, the inherited priority is kept.
+ *
+ * @param pTask The pointer of the task.
+ */
+void mutex_priority_recalculate(struct schedule_task *pTask)
+{
+    _mutex_inheritance_recalculate(pTask);
+}
+#endif
+
+/**
+ * @brief Check if the condition unique id if is's invalid.
+ *
+ * @param id The provided unique id.
+ *
+ * @return The true is invalid, otherwise is valid.
+ */
+static b_t _cond_context_isInvalid(cond_context_t *pCurCond)
+{
+    u32_t start, end;
+    INIT_SECTION_FIRST(INIT_SECTION_OS_COND_LIST, start);
+    INIT_SECTION_LAST(INIT_SECTION_OS_COND_LIST, end);
 
+    return ((u32_t)pCurCond < start || (u32_t)pCurCond >= end) ? true : false;
+}
+
+/**
+ * @brief Check if the condition object if is's initialized.
+ *
+ * @param id The provided unique id.
+ *
+ * @return The true is initialized, otherwise is uninitialized.
+ */
+static b_t _cond_context_isInit(cond_context_t *pCurCond)
+{
+    return ((pCurCond) ? (((pCurCond->head.cs) ? (true) : (false))) : false);
+}
+
+/**
+ * @brief Requeue the signaled condition waiter onto its mutex without waking it to race for the lock.
+ *
+ * @param pTask The pointer of the condition waiter.
+ */
+static void _cond_requeue(struct schedule_task *pTask)
+{
+    mutex_context_t *pCurMutex = (mutex_context_t *)pTask->pPendData;
+
+    if (!pCurMutex->locked) {
+        /* The waiter take the ticket, its timeout can't override the result any more */
+        timeout_remove(&pTask->expire, true);
+        schedule_entry_trigger(pTask, 0u);
+        _mutex_hold(pCurMutex, pTask);
+        trace_contention_acquire(&pCurMutex->contention, NULL);
+        return;
+    }
+
+    /* The signaled waiter reacquires the mutex without the condition timeout */
+    schedule_exit_trigger(pTask, pCurMutex, NULL, &pCurMutex->q_list, OS_TIME_FOREVER_VAL);
+    trace_contention_block(&pCurMutex->contention, &pCurMutex->q_list);
+    _mutex_inheritance_propagate(pCurMutex, pTask->prior);
+}
+
+/**
+ * @brief It's sub-routine running at privilege mode.
+ *
+ * @param pArgs The function argument packages.
+ *
+ * @return The result of privilege routine.
+ */
+static u32_t _mutex_init_privilege_routine(arguments_t *pArgs)
+{
+    ENTER_CRITICAL_SECTION();
+
+    const char_t *pName = (const char_t *)(pArgs[0].pch_val);
+    b_t recursive = (b_t)(pArgs[1].b_val);
+    b_t adaptive = (b_t)(pArgs[2].b_val);
+
+    mutex_context_t *pCurMutex = (mutex_context_t *)init_slot_take(INIT_SLOT_MUTEX);
+    if (!pCurMutex) {
         EXIT_CRITICAL_SECTION();
-        return (u32_t)pCurMutex;
+        return 0u;
     }
 
+    os_memset((char_t *)pCurMutex, 0x0u, sizeof(mutex_context_t));
+    pCurMutex->head.cs = CS_INITED;
+    pCurMutex->head.pName = pName;
+
+    pCurMutex->locked = false;
+    pCurMutex->pHoldTask = NULL;
+    pCurMutex->recursive = recursive;
+    pCurMutex->nesting = 0u;
+    pCurMutex->adaptive = adaptive;
+
     EXIT_CRITICAL_SECTION();
-    return 0u;
+    return (u32_t)pCurMutex;
 }
 
 /**
@@ -94,25 +289,59 @@ static i32p_t _mutex_lock_privilege_routine(arguments_t *pArgs)
     ENTER_CRITICAL_SECTION();
 
     mutex_context_t *pCurMutex = (mutex_context_t *)pArgs[0].u32_val;
+    u32_t timeout_ms = (u32_t)pArgs[1].u32_val;
+    u32_t yields = (u32_t)pArgs[2].u32_val;
+    b_t *pYielded = (b_t *)pArgs[3].pv_val;
     thread_context_t *pCurThread = NULL;
     i32p_t postcode = 0;
 
     pCurThread = kernel_thread_runContextGet();
+
     if (pCurMutex->locked == true) {
-        struct schedule_task *pLockTask = pCurMutex->pHoldTask;
-        if (pCurThread->task.prior < pLockTask->prior) {
-            pLockTask->prior = pCurThread->task.prior;
+        if (pCurMutex->pHoldTask == &pCurThread->task) {
+            if (!pCurMutex->recursive) {
+                // The hold task locks the normal mutex again, it's a self-deadlock.
+                EXIT_CRITICAL_SECTION();
+                return PC_EOR;
+            }
+            pCurMutex->nesting++;
+
+            EXIT_CRITICAL_SECTION();
+            return postcode;
         }
-        postcode = schedule_exit_trigger(&pCurThread->task, pCurMutex, NULL, &pCurMutex->q_list, 0u, true);
+
+        if ((pCurMutex->adaptive) && (yields < MUTEX_ADAPTIVE_YIELD_NUMBER) &&
+            (schedule_yield_to(&pCurThread->task, pCurMutex->pHoldTask))) {
+            /* The ready hold task runs first, the lock is tried again when the current thread runs again */
+            pCurMutex->statistics.yields++;
+            *pYielded = true;
+            postcode = kernel_thread_schedule_request();
+
+            EXIT_CRITICAL_SECTION();
+            return postcode;
+        }
+
+        pCurMutex->statistics.blocked++;
+        postcode = schedule_exit_trigger(&pCurThread->task, pCurMutex, NULL, &pCurMutex->q_list, timeout_ms);
+        schedule_pend_timeout_set(&pCurThread->task, _mutex_pend_timeout);
+        trace_contention_block(&pCurMutex->contention, &pCurMutex->q_list);
+        PC_IF(postcode, PC_PASS)
+        {
+            postcode = PC_OS_WAIT_UNAVAILABLE;
+        }
+
+        /* Transitive priority inheritance */
+        _mutex_inheritance_propagate(pCurMutex, pCurThread->task.prior);
 
         EXIT_CRITICAL_SECTION();
         return postcode;
     }
 
-    /* Highest priority inheritance */
-    pCurMutex->pHoldTask = &pCurThread->task;
-    pCurMutex->originalPriority = pCurThread->task.prior;
-    pCurMutex->locked = true;
+    if (yields) {
+        pCurMutex->statistics.yield_acquired++;
+    }
+    _mutex_hold(pCurMutex, &pCurThread->task);
+    trace_contention_acquire(&pCurMutex->contention, NULL);
 
     EXIT_CRITICAL_SECTION();
     return postcode;
@@ -130,28 +359,151 @@ static i32p_t _mutex_unlock_privilege_routine(arguments_t *pArgs)
     ENTER_CRITICAL_SECTION();
 
     mutex_context_t *pCurMutex = (mutex_context_t *)pArgs[0].u32_val;
+    thread_context_t *pCurThread = kernel_thread_runContextGet();
     i32p_t postcode = 0;
 
-    struct schedule_task *pCurTask = (struct schedule_task *)list_head(&pCurMutex->q_list);
-    struct schedule_task *pLockTask = pCurMutex->pHoldTask;
-    /* priority recovery */
-    pLockTask->prior = pCurMutex->originalPriority;
-    if (!pCurTask) {
-        // no blocking thread
-        pCurMutex->originalPriority = OS_PRIOTITY_INVALID_LEVEL;
-        pCurMutex->pHoldTask = NULL;
-        pCurMutex->locked = false;
-    } else {
-        /* The next thread take the ticket */
-        pCurMutex->pHoldTask = pCurTask;
-        pCurMutex->originalPriority = pCurTask->prior;
-        postcode = schedule_entry_trigger(pCurTask, NULL, 0u);
+    if (!pCurMutex->locked) {
+        EXIT_CRITICAL_SECTION();
+        return PC_EOR;
     }
 
+    if (pCurMutex->pHoldTask != &pCurThread->task) {
+        // Only the hold thread releases its lock and the nesting.
+        EXIT_CRITICAL_SECTION();
+        return PC_EOR;
+    }
+
+    if (pCurMutex->nesting) {
+        pCurMutex->nesting--;
+
+        EXIT_CRITICAL_SECTION();
+        return postcode;
+    }
+
+    postcode = _mutex_release(pCurMutex);
+    kernel_thread_schedule_request();
+
     EXIT_CRITICAL_SECTION();
     return postcode;
 }
 
+/**
+ * @brief It's sub-routine running at privilege mode.
+ *
+ * @param pArgs The function argument packages.
+ *
+ * @return The result of privilege routine.
+ */
+static u32_t _cond_init_privilege_routine(arguments_t *pArgs)
+{
+    ENTER_CRITICAL_SECTION();
+
+    const char_t *pName = (const char_t *)(pArgs[0].pch_val);
+
+    cond_context_t *pCurCond = (cond_context_t *)init_slot_take(INIT_SLOT_COND);
+    if (!pCurCond) {
+        EXIT_CRITICAL_SECTION();
+        return 0u;
+    }
+
+    os_memset((char_t *)pCurCond, 0x0u, sizeof(cond_context_t));
+    pCurCond->head.cs = CS_INITED;
+    pCurCond->head.pName = pName;
+
+    EXIT_CRITICAL_SECTION();
+    return (u32_t)pCurCond;
+}
+
+/**
+ * @brief It's sub-routine running at privilege mode.
+ *
+ * @param pArgs The function argument packages.
+ *
+ * @return The result of privilege routine.
+ */
+static i32p_t _cond_wait_privilege_routine(arguments_t *pArgs)
+{
+    ENTER_CRITICAL_SECTION();
+
+    cond_context_t *pCurCond = (cond_context_t *)pArgs[0].u32_val;
+    mutex_context_t *pCurMutex = (mutex_context_t *)pArgs[1].u32_val;
+    u32_t timeout_ms = (u32_t)pArgs[2].u32_val;
+    thread_context_t *pCurThread = NULL;
+    i32p_t postcode = 0;
+
+    pCurThread = kernel_thread_runContextGet();
+    if ((!pCurMutex->locked) || (pCurMutex->pHoldTask != &pCurThread->task)) {
+        EXIT_CRITICAL_SECTION();
+        return PC_EOR;
+    }
+
+    if (pCurMutex->nesting) {
+        // The nested recursive lock can't be released at once.
+        EXIT_CRITICAL_SECTION();
+        return PC_EOR;
+    }
+
+    /* The mutex release and the condition waiting are in the same critical section, no signal is lost */
+    _mutex_release(pCurMutex);
+    postcode = schedule_exit_trigger(&pCurThread->task, pCurCond, pCurMutex, &pCurCond->q_list, timeout_ms);
+    PC_IF(postcode, PC_PASS)
+    {
+        postcode = PC_OS_WAIT_UNAVAILABLE;
+    }
+
+    EXIT_CRITICAL_SECTION();
+    return postcode;
+}
+
+/**
+ * @brief It's sub-routine running at privilege mode.
+ *
+ * @param pArgs The function argument packages.
+ *
+ * @return The result of privilege routine.
+ */
+static i32p_t _cond_signal_privilege_routine(arguments_t *pArgs)
+{
+    ENTER_CRITICAL_SECTION();
+
+    cond_context_t *pCurCond = (cond_context_t *)pArgs[0].u32_val;
+    b_t broadcast = (b_t)pArgs[1].b_val;
+
+    struct schedule_task *pCurTask = (struct schedule_task *)list_head(&pCurCond->q_list);
+    while (pCurTask) {
+        _cond_requeue(pCurTask);
+        if (!broadcast) {
+            break;
+        }
+        pCurTask = (struct schedule_task *)list_head(&pCurCond->q_list);
+    }
+    i32p_t postcode = kernel_thread_schedule_request();
+
+    EXIT_CRITICAL_SECTION();
+    return postcode;
+}
+
+/**
+ * @brief Check if the current thread holds the recursive mutex, it runs without the privilege call.
+ *
+ * @param pCurMutex The pointer of the mutex.
+ *
+ * @return The true indicates the current thread is the hold task of the recursive mutex.
+ */
+static b_t _mutex_recursive_isHeld(mutex_context_t *pCurMutex)
+{
+    if (!pCurMutex->recursive) {
+        return false;
+    }
+
+    if (!kernel_isInThreadMode()) {
+        return false;
+    }
+
+    // Only the hold task itself can make it equal, so it's stable while the current thread reads it.
+    return (pCurMutex->pHoldTask == &kernel_thread_runContextGet()->task) ? (true) : (false);
+}
+
 /**
  * @brief Initialize a new mutex.
  *
@@ -163,19 +515,58 @@ u32_t _impl_mutex_init(const char_t *pName)
 {
     arguments_t arguments[] = {
         [0] = {.pch_val = (const char_t *)pName},
+        [1] = {.b_val = false},
+        [2] = {.b_val = false},
     };
 
     return kernel_privilege_invoke((const void *)_mutex_init_privilege_routine, arguments);
 }
 
 /**
- * @brief Mutex lock to avoid another thread access this resource.
+ * @brief Initialize a new recursive mutex, the hold task can lock it again with the nesting count.
+ *
+ * @param pName The mutex name.
+ *
+ * @return The mutex unique id.
+ */
+u32_t _impl_mutex_recursive_init(const char_t *pName)
+{
+    arguments_t arguments[] = {
+        [0] = {.pch_val = (const char_t *)pName},
+        [1] = {.b_val = true},
+        [2] = {.b_val = false},
+    };
+
+    return kernel_privilege_invoke((const void *)_mutex_init_privilege_routine, arguments);
+}
+
+/**
+ * @brief Initialize a new adaptive mutex, the contended lock yields to the ready hold task of the same priority before it's blocked.
+ *
+ * @param pName The mutex name.
+ *
+ * @return The mutex unique id.
+ */
+u32_t _impl_mutex_adaptive_init(const char_t *pName)
+{
+    arguments_t arguments[] = {
+        [0] = {.pch_val = (const char_t *)pName},
+        [1] = {.b_val = false},
+        [2] = {.b_val = true},
+    };
+
+    return kernel_privilege_invoke((const void *)_mutex_init_privilege_routine, arguments);
+}
+
+/**
+ * @brief Mutex lock with the timeout to avoid another thread access this resource.
  *
  * @param id The mutex unique id.
+ * @param timeout_ms The mutex lock timeout setting.
  *
  * @return The result of the operation.
  */
-i32p_t _impl_mutex_lock(u32_t ctx)
+i32p_t _impl_mutex_lock_timeout(u32_t ctx, u32_t timeout_ms)
 {
     mutex_context_t *pCtx = (mutex_context_t *)ctx;
     if (_mutex_context_isInvalid(pCtx)) {
@@ -186,15 +577,64 @@ i32p_t _impl_mutex_lock(u32_t ctx)
         return PC_EOR;
     }
 
+    if (!timeout_ms) {
+        return PC_EOR;
+    }
+
     if (!kernel_isInThreadMode()) {
         return PC_EOR;
     }
 
-    arguments_t arguments[] = {
-        [0] = {.u32_val = (u32_t)ctx},
-    };
+    if (_mutex_recursive_isHeld(pCtx)) {
+        /* The owner re-lock fast path */
+        pCtx->nesting++;
+        return 0;
+    }
+
+    i32p_t postcode = 0;
+    b_t yielded = false;
+    u32_t yields = 0u;
+
+    do {
+        yielded = false;
+        arguments_t arguments[] = {
+            [0] = {.u32_val = (u32_t)ctx},
+            [1] = {.u32_val = (u32_t)timeout_ms},
+            [2] = {.u32_val = yields},
+            [3] = {.pv_val = (void *)&yielded},
+        };
+
+        postcode = kernel_privilege_invoke((const void *)_mutex_lock_privilege_routine, arguments);
+        yields++;
+    } while ((yielded) && (!postcode));
+
+    ENTER_CRITICAL_SECTION();
+
+    if (postcode == PC_OS_WAIT_UNAVAILABLE) {
+        postcode = kernel_schedule_result_take();
+    }
 
-    return kernel_privilege_invoke((const void *)_mutex_lock_privilege_routine, arguments);
+    PC_IF(postcode, PC_PASS_INFO)
+    {
+        if (postcode != PC_OS_WAIT_TIMEOUT) {
+            postcode = 0;
+        }
+    }
+
+    EXIT_CRITICAL_SECTION();
+    return postcode;
+}
+
+/**
+ * @brief Mutex lock to avoid another thread access this resource.
+ *
+ * @param id The mutex unique id.
+ *
+ * @return The result of the operation.
+ */
+i32p_t _impl_mutex_lock(u32_t ctx)
+{
+    return _impl_mutex_lock_timeout(ctx, OS_TIME_FOREVER_VAL);
 }
 
 /**
@@ -215,9 +655,184 @@ i32p_t _impl_mutex_unlock(u32_t ctx)
         return PC_EOR;
     }
 
+    if ((_mutex_recursive_isHeld(pCtx)) && (pCtx->nesting)) {
+        /* The owner nesting unlock fast path */
+        pCtx->nesting--;
+        return 0;
+    }
+
     arguments_t arguments[] = {
         [0] = {.u32_val = (u32_t)ctx},
     };
 
     return kernel_privilege_invoke((const void *)_mutex_unlock_privilege_routine, arguments);
 }
+
+/**
+ * @brief Take the mutex statistics snapshot, it shows the yield success versus the block rates.
+ *
+ * @param id The mutex unique id.
+ * @param pStatistics The pointer of the mutex statistics.
+ *
+ * @return The result of the operation.
+ */
+i32p_t _impl_mutex_statistics_get(u32_t ctx, struct mutex_statistics *pStatistics)
+{
+    mutex_context_t *pCtx = (mutex_context_t *)ctx;
+    if (_mutex_context_isInvalid(pCtx)) {
+        return PC_EOR;
+    }
+
+    if (!_mutex_context_isInit(pCtx)) {
+        return PC_EOR;
+    }
+
+    if (!pStatistics) {
+        return PC_EOR;
+    }
+
+    ENTER_CRITICAL_SECTION();
+    *pStatistics = pCtx->statistics;
+    EXIT_CRITICAL_SECTION();
+
+    return 0;
+}
+
+/**
+ * @brief Initialize a new condition variable.
+ *
+ * @param pName The condition variable name.
+ *
+ * @return The condition variable unique id.
+ */
+u32_t _impl_cond_init(const char_t *pName)
+{
+    arguments_t arguments[] = {
+        [0] = {.pch_val = (const char_t *)pName},
+    };
+
+    return kernel_privilege_invoke((const void *)_cond_init_privilege_routine, arguments);
+}
+
+/**
+ * @brief Release the locked mutex and wait for the condition, the mutex is locked again when it returns.
+ *
+ * @param id The condition variable unique id.
+ * @param mutex The mutex unique id that the current thread holds.
+ * @param timeout_ms The condition waiting timeout setting.
+ *
+ * @return The result of the operation.
+ */
+i32p_t _impl_cond_wait(u32_t ctx, u32_t mutex, u32_t timeout_ms)
+{
+    cond_context_t *pCtx = (cond_context_t *)ctx;
+    if (_cond_context_isInvalid(pCtx)) {
+        return PC_EOR;
+    }
+
+    if (!_cond_context_isInit(pCtx)) {
+        return PC_EOR;
+    }
+
+    mutex_context_t *pMutex = (mutex_context_t *)mutex;
+    if (_mutex_context_isInvalid(pMutex)) {
+        return PC_EOR;
+    }
+
+    if (!_mutex_context_isInit(pMutex)) {
+        return PC_EOR;
+    }
+
+    if (!timeout_ms) {
+        return PC_EOR;
+    }
+
+    if (!kernel_isInThreadMode()) {
+        return PC_EOR;
+    }
+
+    arguments_t arguments[] = {
+        [0] = {.u32_val = (u32_t)ctx},
+        [1] = {.u32_val = (u32_t)mutex},
+        [2] = {.u32_val = (u32_t)timeout_ms},
+    };
+
+    i32p_t postcode = kernel_privilege_invoke((const void *)_cond_wait_privilege_routine, arguments);
+
+    ENTER_CRITICAL_SECTION();
+
+    if (postcode == PC_OS_WAIT_UNAVAILABLE) {
+        postcode = kernel_schedule_result_take();
+    }
+
+    PC_IF(postcode, PC_PASS_INFO)
+    {
+        if (postcode != PC_OS_WAIT_TIMEOUT) {
+            postcode = 0;
+        }
+    }
+
+    EXIT_CRITICAL_SECTION();
+
+    if (postcode == PC_OS_WAIT_TIMEOUT) {
+        /* The timed out waiter left the condition without the mutex */
+        i32p_t locked = _impl_mutex_lock(mutex);
+        PC_IF(locked, PC_ERROR)
+        {
+            return locked;
+        }
+    }
+    return postcode;
+}
+
+/**
+ * @brief Move the highest priority waiter of the condition to its mutex.
+ *
+ * @param id The condition variable unique id.
+ *
+ * @return The result of the operation.
+ */
+i32p_t _impl_cond_signal(u32_t ctx)
+{
+    cond_context_t *pCtx = (cond_context_t *)ctx;
+    if (_cond_context_isInvalid(pCtx)) {
+        return PC_EOR;
+    }
+
+    if (!_cond_context_isInit(pCtx)) {
+        return PC_EOR;
+    }
+
+    arguments_t arguments[] = {
+        [0] = {.u32_val = (u32_t)ctx},
+        [1] = {.b_val = false},
+    };
+
+    return kernel_privilege_invoke((const void *)_cond_signal_privilege_routine, arguments);
+}
+
+/**
+ * @brief Move all waiters of the condition to their mutex, they're requeued rather than woken up to race.
+ *
+ * @param id The condition variable unique id.
+ *
+ * @return The result of the operation.
+ */
+i32p_t _impl_cond_broadcast(u32_t ctx)
+{
+    cond_context_t *pCtx = (cond_context_t *)ctx;
+    if (_cond_context_isInvalid(pCtx)) {
+        return PC_EOR;
+    }
+
+    if (!_cond_context_isInit(pCtx)) {
+        return PC_EOR;
+    }
+
+    arguments_t arguments[] = {
+        [0] = {.u32_val = (u32_t)ctx},
+        [1] = {.b_val = true},
+    };
+
+    return kernel_privilege_invoke((const void *)_cond_signal_privilege_routine, arguments);
+}
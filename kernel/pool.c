@@ -102,28 +102,6 @@ static bool _mem_release(pool_context_t *pCurPool, void *pUserMem)
     return (pMemTake == pUserMem) ? (true) : (false);
 }
 
-/**
- * @brief The pool schedule routine execute the the pendsv context.
- *
- * @param id The unique id of the entry thread.
- */
-static void _pool_schedule(void *pTask)
-{
-    struct schedule_task *pCurTask = (struct schedule_task *)pTask;
-    timeout_remove(&pCurTask->expire, true);
-    pool_context_t *pCurPool = (pool_context_t *)pCurTask->pPendCtx;
-    void **ppUserMemAddress = (void **)pCurTask->pPendData;
-    if (!*ppUserMemAddress) {
-        return;
-    }
-    *ppUserMemAddress = _mem_take(pCurPool);
-    if (!*ppUserMemAddress) {
-        pCurTask->exec.entry.result = PC_EOR;
-    } else {
-        pCurTask->exec.entry.result = 0;
-    }
-}
-
 /**
  * @brief It's sub-routine running at privilege mode.
  *
@@ -140,30 +118,23 @@ static u32_t _pool_init_privilege_routine(arguments_t *pArgs)
     u16_t elementNum = (u16_t)(pArgs[2].u16_val);
     const char_t *pName = (const char_t *)(pArgs[3].pch_val);
 
-    INIT_SECTION_FOREACH(INIT_SECTION_OS_POOL_LIST, pool_context_t, pCurPool)
-    {
-        if (_pool_context_isInvalid(pCurPool)) {
-            break;
-        }
-
-        if (_pool_context_isInit(pCurPool)) {
-            continue;
-        }
-        os_memset((char_t *)pCurPool, 0x0u, sizeof(pool_context_t));
-        pCurPool->head.cs = CS_INITED;
-        pCurPool->head.pName = pName;
+    pool_context_t *pCurPool = (pool_context_t *)init_slot_take(INIT_SLOT_POOL);
+    if (!pCurPool) {
+        EXIT_CRITICAL_SECTION();
+        return 0u;
+    }
 
-        pCurPool->pMemAddress = pMemAddr;
-        pCurPool->elementLength = elementLen;
-        pCurPool->elementNumber = elementNum;
-        pCurPool->elementFreeBits = Bs(0u, (elementNum - 1u));
+    os_memset((char_t *)pCurPool, 0x0u, sizeof(pool_context_t));
+    pCurPool->head.cs = CS_INITED;
+    pCurPool->head.pName = pName;
 
-        EXIT_CRITICAL_SECTION();
-        return (u32_t)pCurPool;
-    };
+    pCurPool->pMemAddress = pMemAddr;
+    pCurPool->elementLength = elementLen;
+    pCurPool->elementNumber = elementNum;
+    pCurPool->elementFreeBits = Bs(0u, (elementNum - 1u));
 
     EXIT_CRITICAL_SECTION();
-    return 0u;
+    return (u32_t)pCurPool;
 }
 
 /**
@@ -195,7 +166,7 @@ static i32p_t _pool_take_privilege_routine(arguments_t *pArgs)
             EXIT_CRITICAL_SECTION();
             return PC_EOR;
         }
-        postcode = schedule_exit_trigger(&pCurThread->task, pCurPool, ppUserBuffer, &pCurPool->q_list, timeout_ms, true);
+        postcode = schedule_exit_trigger(&pCurThread->task, pCurPool, ppUserBuffer, &pCurPool->q_list, timeout_ms);
         PC_IF(postcode, PC_PASS)
         {
             postcode = PC_OS_WAIT_UNAVAILABLE;
@@ -233,13 +204,14 @@ static i32p_t _pool_release_privilege_routine(arguments_t *pArgs)
     }
     *ppUserBuffer = NULL;
 
-    /* Try to wakeup a blocking thread */
-    list_iterator_t it = {0u};
-    list_t *pList = (list_t *)&pCurPool->q_list;
-    list_iterator_init(&it, pList);
-    struct schedule_task *pCurTask = (struct schedule_task *)list_iterator_next(&it);
+    /* Try to wakeup a blocking thread and hand the released element to it */
+    struct schedule_task *pCurTask = (struct schedule_task *)list_head(&pCurPool->q_list);
     if (pCurTask) {
-        postcode = schedule_entry_trigger(pCurTask, _pool_schedule, 0u);
+        void **ppUserMemAddress = (void **)pCurTask->pPendData;
+        *ppUserMemAddress = _mem_take(pCurPool);
+
+        timeout_remove(&pCurTask->expire, true);
+        postcode = schedule_entry_trigger(pCurTask, ((*ppUserMemAddress) ? (0) : (PC_EOR)));
     }
 
     EXIT_CRITICAL_SECTION();
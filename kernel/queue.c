@@ -14,8 +14,7 @@
  * Local unique postcode.
  */
 #define PC_EOR                 PC_IER(PC_OS_CMPT_QUEUE_6)
-#define _QUEUE_WAKEUP_SENDER   (10u)
-#define _QUEUE_WAKEUP_RECEIVER (11u)
+#define _QUEUE_SLOT_INVALID    (0xFFFFu)
 
 /**
  * @brief Check if the queue unique id if is's invalid.
@@ -136,37 +135,205 @@ static void _message_receive_behind(queue_context_t *pCurQueue, const u8_t *pUse
 }
 
 /**
- * @brief The queue schedule routine execute the the pendsv context.
+ * @brief Get the slot address of the priority queue.
  *
- * @param id The unique id of the entry thread.
+ * @param pCurQueue The current queue context.
+ * @param index The slot index.
+ *
+ * @return The slot address, the element follows the next slot index.
+ */
+static u8_t *_message_priority_slot(queue_context_t *pCurQueue, u16_t index)
+{
+    return (u8_t *)((u32_t)(index * QUEUE_PRIORITY_SLOT_SIZE(pCurQueue->elementLength)) + (u32_t)pCurQueue->pQueueBufferAddress);
+}
+
+/**
+ * @brief Get the next slot index of the priority queue.
+ *
+ * @param pCurQueue The current queue context.
+ * @param index The slot index.
+ *
+ * @return The next slot index.
+ */
+static u16_t _message_priority_next_get(queue_context_t *pCurQueue, u16_t index)
+{
+    return *((u16_t *)_message_priority_slot(pCurQueue, index));
+}
+
+/**
+ * @brief Set the next slot index of the priority queue.
+ *
+ * @param pCurQueue The current queue context.
+ * @param index The slot index.
+ * @param next The next slot index.
  */
-static void _queue_schedule(void *pTask)
+static void _message_priority_next_set(queue_context_t *pCurQueue, u16_t index, u16_t next)
 {
-    struct schedule_task *pCurTask = (struct schedule_task *)pTask;
-    struct call_entry *pEntry = &pCurTask->exec.entry;
+    *((u16_t *)_message_priority_slot(pCurQueue, index)) = next;
+}
 
-    timeout_remove(&pCurTask->expire, true);
+/**
+ * @brief Link all slots of the priority queue into the free list.
+ *
+ * @param pCurQueue The current queue context.
+ */
+static void _message_priority_init(queue_context_t *pCurQueue)
+{
+    for (u16_t i = 0u; i < pCurQueue->elementNumber; i++) {
+        _message_priority_next_set(pCurQueue, i, ((i + 1u) < pCurQueue->elementNumber) ? (i + 1u) : (_QUEUE_SLOT_INVALID));
+    }
+    pCurQueue->freeSlot = 0u;
 
-    queue_context_t *pCurQueue = (queue_context_t *)pCurTask->pPendCtx;
-    queue_sch_t *pQue_sche = (queue_sch_t *)pCurTask->pPendData;
-    if (!pQue_sche) {
-        return;
+    for (u8_t i = 0u; i < QUEUE_PRIORITY_NUMBER; i++) {
+        pCurQueue->priorityHead[i] = _QUEUE_SLOT_INVALID;
+        pCurQueue->priorityTail[i] = _QUEUE_SLOT_INVALID;
     }
-    if (pEntry->result == _QUEUE_WAKEUP_RECEIVER) {
-        if (pQue_sche->reverse) {
-            _message_receive_behind((queue_context_t *)pCurQueue, pQue_sche->pUsrBuf, pQue_sche->size);
-        } else {
-            _message_receive((queue_context_t *)pCurQueue, pQue_sche->pUsrBuf, pQue_sche->size);
+    pCurQueue->priorityBits = 0u;
+}
+
+/**
+ * @brief Send a message into its priority level of the priority queue.
+ *
+ * @param pCurQueue The current queue context.
+ * @param pUserBuffer The pointer of user's message buffer.
+ * @param userSize The size of user's message buffer.
+ * @param priority The message priority, the zero is the highest.
+ * @param isToFront The message is put in front of the same priority messages.
+ */
+static void _message_priority_send(queue_context_t *pCurQueue, const u8_t *pUserBuffer, u16_t userSize, u8_t priority, b_t isToFront)
+{
+    u16_t index = pCurQueue->freeSlot;
+    pCurQueue->freeSlot = _message_priority_next_get(pCurQueue, index);
+
+    u8_t *pInBuffer = _message_priority_slot(pCurQueue, index) + sizeof(u16_t);
+    os_memset((char_t *)pInBuffer, 0x0u, pCurQueue->elementLength);
+    os_memcpy((char_t *)pInBuffer, (const char_t *)pUserBuffer, userSize);
+
+    if (pCurQueue->priorityHead[priority] == _QUEUE_SLOT_INVALID) {
+        _message_priority_next_set(pCurQueue, index, _QUEUE_SLOT_INVALID);
+        pCurQueue->priorityHead[priority] = index;
+        pCurQueue->priorityTail[priority] = index;
+    } else if (isToFront) {
+        _message_priority_next_set(pCurQueue, index, pCurQueue->priorityHead[priority]);
+        pCurQueue->priorityHead[priority] = index;
+    } else {
+        _message_priority_next_set(pCurQueue, index, _QUEUE_SLOT_INVALID);
+        _message_priority_next_set(pCurQueue, pCurQueue->priorityTail[priority], index);
+        pCurQueue->priorityTail[priority] = index;
+    }
+    pCurQueue->priorityBits |= B(priority);
+    pCurQueue->cacheSize++;
+}
+
+/**
+ * @brief Receive the oldest message of the highest priority level from the priority queue.
+ *
+ * @param pCurQueue The current queue context.
+ * @param pUserBuffer The pointer of user's message buffer.
+ * @param userSize The size of user's message buffer.
+ */
+static void _message_priority_receive(queue_context_t *pCurQueue, const u8_t *pUserBuffer, u16_t userSize)
+{
+    u8_t priority = 0u;
+    while (!(pCurQueue->priorityBits & B(priority))) {
+        priority++;
+    }
+
+    u16_t index = pCurQueue->priorityHead[priority];
+    pCurQueue->priorityHead[priority] = _message_priority_next_get(pCurQueue, index);
+    if (pCurQueue->priorityHead[priority] == _QUEUE_SLOT_INVALID) {
+        pCurQueue->priorityTail[priority] = _QUEUE_SLOT_INVALID;
+        pCurQueue->priorityBits &= ~B(priority);
+    }
+
+    u8_t *pOutBuffer = _message_priority_slot(pCurQueue, index) + sizeof(u16_t);
+    os_memset((char_t *)pUserBuffer, 0x0u, userSize);
+    os_memcpy((char_t *)pUserBuffer, (const char_t *)pOutBuffer, userSize);
+
+    _message_priority_next_set(pCurQueue, index, pCurQueue->freeSlot);
+    pCurQueue->freeSlot = index;
+    pCurQueue->cacheSize--;
+}
+
+/**
+ * @brief Send a message to the queue by its scheduled options.
+ *
+ * @param pCurQueue The current queue context.
+ * @param pQue_sch The pointer of the queue schedule options.
+ */
+static void _message_send_sch(queue_context_t *pCurQueue, queue_sch_t *pQue_sch)
+{
+    if (pCurQueue->priority) {
+        _message_priority_send(pCurQueue, pQue_sch->pUsrBuf, pQue_sch->size, pQue_sch->priority, pQue_sch->reverse);
+    } else if (pQue_sch->reverse) {
+        _message_send_front(pCurQueue, pQue_sch->pUsrBuf, pQue_sch->size);
+    } else {
+        _message_send(pCurQueue, pQue_sch->pUsrBuf, pQue_sch->size);
+    }
+    trace_contention_depth(&pCurQueue->contention, pCurQueue->cacheSize);
+}
+
+/**
+ * @brief Receive a message from the queue by its scheduled options.
+ *
+ * @param pCurQueue The current queue context.
+ * @param pQue_sch The pointer of the queue schedule options.
+ */
+static void _message_receive_sch(queue_context_t *pCurQueue, queue_sch_t *pQue_sch)
+{
+    if (pCurQueue->priority) {
+        _message_priority_receive(pCurQueue, pQue_sch->pUsrBuf, pQue_sch->size);
+    } else if (pQue_sch->reverse) {
+        _message_receive_behind(pCurQueue, pQue_sch->pUsrBuf, pQue_sch->size);
+    } else {
+        _message_receive(pCurQueue, pQue_sch->pUsrBuf, pQue_sch->size);
+    }
+}
+
+/**
+ * @brief Hand the messages to the blocked receivers and the free slots to the blocked senders until none can be served,
+ * the data is copied into or out of each waiter buffer before it's woken up.
+ *
+ * @param pCurQueue The current queue context.
+ *
+ * @return The result of the operation.
+ */
+static i32p_t _queue_transfer(queue_context_t *pCurQueue)
+{
+    i32p_t postcode = 0;
+    b_t progress = true;
+
+    while (progress) {
+        progress = false;
+
+        struct schedule_task *pReceiver = (struct schedule_task *)list_head(&pCurQueue->out_QList);
+        while ((pReceiver) && (pCurQueue->cacheSize)) {
+            _message_receive_sch(pCurQueue, (queue_sch_t *)pReceiver->pPendData);
+
+            /* The receiver take the message, its timeout can't override the result any more */
+            timeout_remove(&pReceiver->expire, true);
+            postcode = schedule_entry_trigger(pReceiver, 0u);
+            trace_contention_acquire(&pCurQueue->contention, pReceiver);
+            progress = true;
+
+            pReceiver = (struct schedule_task *)list_head(&pCurQueue->out_QList);
         }
-        pEntry->result = 0;
-    } else if (pEntry->result == _QUEUE_WAKEUP_SENDER) {
-        if (pQue_sche->reverse) {
-            _message_send_front((queue_context_t *)pCurQueue, pQue_sche->pUsrBuf, pQue_sche->size);
-        } else {
-            _message_send((queue_context_t *)pCurQueue, pQue_sche->pUsrBuf, pQue_sche->size);
+
+        struct schedule_task *pSender = (struct schedule_task *)list_head(&pCurQueue->in_QList);
+        while ((pSender) && (pCurQueue->cacheSize < pCurQueue->elementNumber)) {
+            _message_send_sch(pCurQueue, (queue_sch_t *)pSender->pPendData);
+
+            /* The sender put the message, its timeout can't override the result any more */
+            timeout_remove(&pSender->expire, true);
+            postcode = schedule_entry_trigger(pSender, 0u);
+            trace_contention_acquire(&pCurQueue->contention, pSender);
+            progress = true;
+
+            pSender = (struct schedule_task *)list_head(&pCurQueue->in_QList);
         }
-        pEntry->result = 0;
     }
+
+    return postcode;
 }
 
 /**
@@ -184,34 +351,31 @@ static u32_t _queue_init_privilege_routine(arguments_t *pArgs)
     u16_t elementLen = (u16_t)(pArgs[1].u16_val);
     u16_t elementNum = (u16_t)(pArgs[2].u16_val);
     const char_t *pName = (const char_t *)(pArgs[3].pch_val);
+    b_t priority = (b_t)(pArgs[4].b_val);
 
-    INIT_SECTION_FOREACH(INIT_SECTION_OS_QUEUE_LIST, queue_context_t, pCurQueue)
-    {
-        if (_queue_context_isInvalid(pCurQueue)) {
-            break;
-        }
-
-        if (_queue_context_isInit(pCurQueue)) {
-            continue;
-        }
-
-        os_memset((char_t *)pCurQueue, 0x0u, sizeof(queue_context_t));
-        pCurQueue->head.cs = CS_INITED;
-        pCurQueue->head.pName = pName;
-
-        pCurQueue->pQueueBufferAddress = pQueueBufferAddr;
-        pCurQueue->elementLength = elementLen;
-        pCurQueue->elementNumber = elementNum;
-        pCurQueue->leftPosition = 0u;
-        pCurQueue->rightPosition = 0u;
-        pCurQueue->cacheSize = 0u;
-
+    queue_context_t *pCurQueue = (queue_context_t *)init_slot_take(INIT_SLOT_QUEUE);
+    if (!pCurQueue) {
         EXIT_CRITICAL_SECTION();
-        return (u32_t)pCurQueue;
-    };
+        return 0u;
+    }
+
+    os_memset((char_t *)pCurQueue, 0x0u, sizeof(queue_context_t));
+    pCurQueue->head.cs = CS_INITED;
+    pCurQueue->head.pName = pName;
+
+    pCurQueue->pQueueBufferAddress = pQueueBufferAddr;
+    pCurQueue->elementLength = elementLen;
+    pCurQueue->elementNumber = elementNum;
+    pCurQueue->leftPosition = 0u;
+    pCurQueue->rightPosition = 0u;
+    pCurQueue->cacheSize = 0u;
+    pCurQueue->priority = priority;
+    if (priority) {
+        _message_priority_init(pCurQueue);
+    }
 
     EXIT_CRITICAL_SECTION();
-    return 0u;
+    return (u32_t)pCurQueue;
 }
 
 /**
@@ -236,30 +400,31 @@ static i32p_t _queue_send_privilege_routine(arguments_t *pArgs)
         return PC_EOR;
     }
 
+    if (pQue_sch->priority >= QUEUE_PRIORITY_NUMBER) {
+        EXIT_CRITICAL_SECTION();
+        return PC_EOR;
+    }
+
     if (pCurQueue->cacheSize == pCurQueue->elementNumber) {
         if (timeout_ms == OS_TIME_NOWAIT_VAL) {
+            /* The caller polls it, it's not an error */
             EXIT_CRITICAL_SECTION();
-            return PC_EOR;
+            return PC_OS_WAIT_TIMEOUT;
         }
-        postcode = schedule_exit_trigger(&pCurThread->task, pCurQueue, pQue_sch, &pCurQueue->in_QList, timeout_ms, true);
+        postcode = schedule_exit_trigger(&pCurThread->task, pCurQueue, pQue_sch, &pCurQueue->in_QList, timeout_ms);
+        trace_contention_block(&pCurQueue->contention, &pCurQueue->in_QList);
         PC_IF(postcode, PC_PASS)
         {
             postcode = PC_OS_WAIT_UNAVAILABLE;
         }
     } else {
-        if (pQue_sch->reverse) {
-            _message_send_front(pCurQueue, pQue_sch->pUsrBuf, pQue_sch->size);
-        } else {
-            _message_send(pCurQueue, pQue_sch->pUsrBuf, pQue_sch->size);
-        }
+        _message_send_sch(pCurQueue, pQue_sch);
+        trace_contention_acquire(&pCurQueue->contention, NULL);
 
-        /* Try to wakeup a blocking thread */
-        list_iterator_t it = {0u};
-        list_t *plist = (list_t *)&pCurQueue->out_QList;
-        list_iterator_init(&it, plist);
-        struct schedule_task *pCurTask = (struct schedule_task *)list_iterator_next(&it);
-        if (pCurTask) {
-            postcode = schedule_entry_trigger(pCurTask, _queue_schedule, _QUEUE_WAKEUP_RECEIVER);
+        /* Try to wakeup the blocking threads */
+        postcode = _queue_transfer(pCurQueue);
+        if (pCurQueue->cacheSize) {
+            coroutine_object_post(&pCurQueue->pCoGroup);
         }
     }
 
@@ -281,6 +446,7 @@ static i32p_t _queue_receive_privilege_routine(arguments_t *pArgs)
     queue_context_t *pCurQueue = (queue_context_t *)pArgs[0].u32_val;
     queue_sch_t *pQue_sch = (queue_sch_t *)pArgs[1].ptr_val;
     u32_t timeout_ms = (u32_t)pArgs[2].u32_val;
+    struct coroutine_context *pCurCo = (struct coroutine_context *)pArgs[3].pv_val;
     i32p_t postcode = 0;
 
     thread_context_t *pCurThread = (thread_context_t *)kernel_thread_runContextGet();
@@ -289,31 +455,33 @@ static i32p_t _queue_receive_privilege_routine(arguments_t *pArgs)
         return PC_EOR;
     }
 
+    if ((pCurQueue->priority) && (pQue_sch->reverse)) {
+        // The priority queue always takes the highest priority message first.
+        EXIT_CRITICAL_SECTION();
+        return PC_EOR;
+    }
+
     if (!pCurQueue->cacheSize) {
         if (timeout_ms == OS_TIME_NOWAIT_VAL) {
+            /* The caller polls it, it's not an error */
+            if (pCurCo) {
+                coroutine_object_subscribe(pCurCo, &pCurQueue->pCoGroup);
+            }
             EXIT_CRITICAL_SECTION();
-            return PC_EOR;
+            return PC_OS_WAIT_TIMEOUT;
         }
-        postcode = schedule_exit_trigger(&pCurThread->task, pCurQueue, pQue_sch, &pCurQueue->out_QList, timeout_ms, true);
+        postcode = schedule_exit_trigger(&pCurThread->task, pCurQueue, pQue_sch, &pCurQueue->out_QList, timeout_ms);
+        trace_contention_block(&pCurQueue->contention, &pCurQueue->out_QList);
         PC_IF(postcode, PC_PASS)
         {
             postcode = PC_OS_WAIT_UNAVAILABLE;
         }
     } else {
-        if (pQue_sch->reverse) {
-            _message_receive_behind(pCurQueue, (const u8_t *)pQue_sch->pUsrBuf, pQue_sch->size);
-        } else {
-            _message_receive(pCurQueue, (const u8_t *)pQue_sch->pUsrBuf, pQue_sch->size);
-        }
+        _message_receive_sch(pCurQueue, pQue_sch);
+        trace_contention_acquire(&pCurQueue->contention, NULL);
 
-        /* Try to wakeup a blocking task */
-        list_iterator_t it = {0u};
-        list_t *plist = (list_t *)&pCurQueue->in_QList;
-        list_iterator_init(&it, plist);
-        struct schedule_task *pCurTask = (struct schedule_task *)list_iterator_next(&it);
-        if (pCurTask) {
-            postcode = schedule_entry_trigger(pCurTask, _queue_schedule, _QUEUE_WAKEUP_SENDER);
-        }
+        /* Try to wakeup the blocking threads */
+        postcode = _queue_transfer(pCurQueue);
     }
 
     EXIT_CRITICAL_SECTION();
@@ -349,23 +517,60 @@ u32_t _impl_queue_init(const void *pQueueBufferAddr, u16_t elementLen, u16_t ele
         [1] = {.u16_val = (u16_t)elementLen},
         [2] = {.u16_val = (u16_t)elementNum},
         [3] = {.pch_val = (const char_t *)pName},
+        [4] = {.b_val = false},
     };
 
     return kernel_privilege_invoke((const void *)_queue_init_privilege_routine, arguments);
 }
 
 /**
- * @brief Send a queue message.
+ * @brief Initialize a new priority queue, the buffer holds QUEUE_PRIORITY_SLOT_SIZE(elementLen) bytes for each element.
+ *
+ * @param pName The queue name.
+ * @param pQueueBufferAddr The pointer of the queue buffer.
+ * @param elementLen The element size.
+ * @param elementNum The element number.
+ *
+ * @return The queue unique id.
+ */
+u32_t _impl_queue_priority_init(const void *pQueueBufferAddr, u16_t elementLen, u16_t elementNum, const char_t *pName)
+{
+    if (!pQueueBufferAddr) {
+        return OS_INVALID_ID_VAL;
+    }
+
+    if (!elementLen) {
+        return OS_INVALID_ID_VAL;
+    }
+
+    if ((!elementNum) || (elementNum >= _QUEUE_SLOT_INVALID)) {
+        return OS_INVALID_ID_VAL;
+    }
+
+    arguments_t arguments[] = {
+        [0] = {.u32_val = (u32_t)pQueueBufferAddr},
+        [1] = {.u16_val = (u16_t)elementLen},
+        [2] = {.u16_val = (u16_t)elementNum},
+        [3] = {.pch_val = (const char_t *)pName},
+        [4] = {.b_val = true},
+    };
+
+    return kernel_privilege_invoke((const void *)_queue_init_privilege_routine, arguments);
+}
+
+/**
+ * @brief Send a queue message with its priority, the priority is ignored by the normal queue.
  *
  * @param ctx The queue unique id.
  * @param pUserBuffer The pointer of the message buffer address.
  * @param bufferSize The queue buffer size.
+ * @param priority The message priority, the zero is the highest.
  * @param isToFront The direction of the message operation.
  * @param timeout_ms The queue send timeout option.
  *
  * @return The result of the operation.
  */
-i32p_t _impl_queue_send(u32_t ctx, const u8_t *pUserBuffer, u16_t bufferSize, b_t isToFront, u32_t timeout_ms)
+i32p_t _impl_queue_priority_send(u32_t ctx, const u8_t *pUserBuffer, u16_t bufferSize, u8_t priority, b_t isToFront, u32_t timeout_ms)
 {
     queue_context_t *pCtx = (queue_context_t *)ctx;
     if (_queue_context_isInvalid(pCtx)) {
@@ -382,7 +587,7 @@ i32p_t _impl_queue_send(u32_t ctx, const u8_t *pUserBuffer, u16_t bufferSize, b_
         }
     }
 
-    queue_sch_t que_sch = {.pUsrBuf = pUserBuffer, .size = bufferSize, .reverse = isToFront};
+    queue_sch_t que_sch = {.pUsrBuf = pUserBuffer, .size = bufferSize, .reverse = isToFront, .priority = priority};
     arguments_t arguments[] = {
         [0] = {.u32_val = (u32_t)ctx},
         [1] = {.ptr_val = (void *)&que_sch},
@@ -407,17 +612,36 @@ i32p_t _impl_queue_send(u32_t ctx, const u8_t *pUserBuffer, u16_t bufferSize, b_
 }
 
 /**
- * @brief Receive a queue message.
+ * @brief Send a queue message.
  *
- * @param id The queue unique id.
+ * @param ctx The queue unique id.
  * @param pUserBuffer The pointer of the message buffer address.
  * @param bufferSize The queue buffer size.
- * @param isFromBack The direction of the message operation.
+ * @param isToFront The direction of the message operation.
  * @param timeout_ms The queue send timeout option.
  *
  * @return The result of the operation.
  */
-i32p_t _impl_queue_receive(u32_t ctx, const u8_t *pUserBuffer, u16_t bufferSize, b_t isFromBack, u32_t timeout_ms)
+i32p_t _impl_queue_send(u32_t ctx, const u8_t *pUserBuffer, u16_t bufferSize, b_t isToFront, u32_t timeout_ms)
+{
+    /* The priority queue takes it as the lowest priority message */
+    return _impl_queue_priority_send(ctx, pUserBuffer, bufferSize, (QUEUE_PRIORITY_NUMBER - 1u), isToFront, timeout_ms);
+}
+
+/**
+ * @brief Check the queue context and invoke the queue receive routine.
+ *
+ * @param ctx The queue unique id.
+ * @param pUserBuffer The pointer of the message buffer address.
+ * @param bufferSize The queue buffer size.
+ * @param isFromBack The direction of the message operation.
+ * @param timeout_ms The queue receive timeout option.
+ * @param pCo The pointer of the coroutine that polls it, or NULL.
+ *
+ * @return The result of the operation.
+ */
+static i32p_t _queue_receive_invoke(u32_t ctx, const u8_t *pUserBuffer, u16_t bufferSize, b_t isFromBack, u32_t timeout_ms,
+                                    struct coroutine_context *pCo)
 {
     queue_context_t *pCtx = (queue_context_t *)ctx;
     if (_queue_context_isInvalid(pCtx)) {
@@ -434,11 +658,12 @@ i32p_t _impl_queue_receive(u32_t ctx, const u8_t *pUserBuffer, u16_t bufferSize,
         }
     }
 
-    queue_sch_t que_sch = {.pUsrBuf = pUserBuffer, .size = bufferSize, .reverse = isFromBack};
+    queue_sch_t que_sch = {.pUsrBuf = pUserBuffer, .size = bufferSize, .reverse = isFromBack, .priority = 0u};
     arguments_t arguments[] = {
         [0] = {.u32_val = (u32_t)ctx},
         [1] = {.ptr_val = (void *)&que_sch},
         [2] = {.u32_val = (u32_t)timeout_ms},
+        [3] = {.pv_val = (void *)pCo},
     };
     i32p_t postcode = kernel_privilege_invoke((const void *)_queue_receive_privilege_routine, arguments);
 
@@ -458,3 +683,39 @@ i32p_t _impl_queue_receive(u32_t ctx, const u8_t *pUserBuffer, u16_t bufferSize,
     EXIT_CRITICAL_SECTION();
     return postcode;
 }
+
+/**
+ * @brief Receive a queue message.
+ *
+ * @param id The queue unique id.
+ * @param pUserBuffer The pointer of the message buffer address.
+ * @param bufferSize The queue buffer size.
+ * @param isFromBack The direction of the message operation.
+ * @param timeout_ms The queue send timeout option.
+ *
+ * @return The result of the operation.
+ */
+i32p_t _impl_queue_receive(u32_t ctx, const u8_t *pUserBuffer, u16_t bufferSize, b_t isFromBack, u32_t timeout_ms)
+{
+    return _queue_receive_invoke(ctx, pUserBuffer, bufferSize, isFromBack, timeout_ms, NULL);
+}
+
+/**
+ * @brief Receive a queue message in the coroutine without waiting, the send wakes the coroutine group up when it's empty.
+ *
+ * @param id The queue unique id.
+ * @param pUserBuffer The pointer of the message buffer address.
+ * @param bufferSize The queue buffer size.
+ * @param isFromBack The direction of the message operation.
+ * @param pCo The pointer of the coroutine.
+ *
+ * @return The result of the operation.
+ */
+i32p_t _impl_queue_co_receive(u32_t ctx, const u8_t *pUserBuffer, u16_t bufferSize, b_t isFromBack, struct coroutine_context *pCo)
+{
+    if (!pCo) {
+        return PC_EOR;
+    }
+
+    return _queue_receive_invoke(ctx, pUserBuffer, bufferSize, isFromBack, OS_TIME_NOWAIT_VAL, pCo);
+}
@@ -0,0 +1,252 @@
+/**
+ * Copyright (c) Riven Zheng (zhengheiot@gmail.com).
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ **/
+#include "at_rtos.h"
+#include "kernel.h"
+#include "timer.h"
+#include "postcode.h"
+
+/**
+ * Local unique postcode.
+ */
+#define PC_EOR PC_IER(PC_OS_CMPT_RTC_15)
+
+/**
+ * @brief Wake the level host thread up if it's waiting, it's called in the critical section.
+ *
+ * @param pCurLevel The pointer of the run-to-completion level.
+ *
+ * @return The result of the operation.
+ */
+static i32p_t _rtc_level_notify(struct rtc_level *pCurLevel)
+{
+    struct schedule_task *pCurTask = pCurLevel->pTask;
+
+    if ((pCurTask) && (pCurTask->pPendCtx == (void *)pCurLevel)) {
+        timeout_remove(&pCurTask->expire, true);
+        return schedule_entry_trigger(pCurTask, 0u);
+    }
+
+    /* The host thread is handling, it takes another pass before it waits */
+    pCurLevel->notified = true;
+    return 0;
+}
+
+/**
+ * @brief It's sub-routine running at privilege mode.
+ *
+ * @param pArgs The function argument packages.
+ *
+ * @return The result of privilege routine.
+ */
+static i32p_t _rtc_post_privilege_routine(arguments_t *pArgs)
+{
+    ENTER_CRITICAL_SECTION();
+    struct rtc_task *pCurTask = (struct rtc_task *)pArgs[0].pv_val;
+    u32_t event = (u32_t)pArgs[1].u32_val;
+    i32p_t postcode = 0;
+
+    if (pCurTask->count >= pCurTask->depth) {
+        pCurTask->dropped++;
+        EXIT_CRITICAL_SECTION();
+        return PC_EOR;
+    }
+
+    pCurTask->pEvents[(pCurTask->head + pCurTask->count) % pCurTask->depth] = event;
+    pCurTask->count++;
+
+    if (pCurTask->pLevel) {
+        postcode = _rtc_level_notify(pCurTask->pLevel);
+    }
+
+    EXIT_CRITICAL_SECTION();
+    return postcode;
+}
+
+/**
+ * @brief It's sub-routine running at privilege mode.
+ *
+ * @param pArgs The function argument packages.
+ *
+ * @return The result of privilege routine.
+ */
+static i32p_t _rtc_task_add_privilege_routine(arguments_t *pArgs)
+{
+    ENTER_CRITICAL_SECTION();
+    struct rtc_level *pCurLevel = (struct rtc_level *)pArgs[0].pv_val;
+    struct rtc_task *pCurTask = (struct rtc_task *)pArgs[1].pv_val;
+
+    if (pCurTask->pLevel) {
+        EXIT_CRITICAL_SECTION();
+        return PC_EOR;
+    }
+
+    /* The tasks are handled in the adding order */
+    struct rtc_task **ppTask = &pCurLevel->pHead;
+    while (*ppTask) {
+        ppTask = &(*ppTask)->pNext;
+    }
+    *ppTask = pCurTask;
+    pCurTask->pNext = NULL;
+    pCurTask->pLevel = pCurLevel;
+
+    i32p_t postcode = 0;
+    if (pCurTask->count) {
+        postcode = _rtc_level_notify(pCurLevel);
+    }
+
+    EXIT_CRITICAL_SECTION();
+    return postcode;
+}
+
+/**
+ * @brief It's sub-routine running at privilege mode.
+ *
+ * @param pArgs The function argument packages.
+ *
+ * @return The result of privilege routine.
+ */
+static i32p_t _rtc_event_take_privilege_routine(arguments_t *pArgs)
+{
+    ENTER_CRITICAL_SECTION();
+    struct rtc_task *pCurTask = (struct rtc_task *)pArgs[0].pv_val;
+    u32_t *pEvent = (u32_t *)pArgs[1].pv_val;
+
+    if (!pCurTask->count) {
+        EXIT_CRITICAL_SECTION();
+        return PC_OS_WAIT_UNAVAILABLE;
+    }
+
+    *pEvent = pCurTask->pEvents[pCurTask->head];
+    pCurTask->head = (u16_t)((pCurTask->head + 1u) % pCurTask->depth);
+    pCurTask->count--;
+    pCurTask->dispatched++;
+
+    EXIT_CRITICAL_SECTION();
+    return 0;
+}
+
+/**
+ * @brief It's sub-routine running at privilege mode.
+ *
+ * @param pArgs The function argument packages.
+ *
+ * @return The result of privilege routine.
+ */
+static i32p_t _rtc_level_wait_privilege_routine(arguments_t *pArgs)
+{
+    ENTER_CRITICAL_SECTION();
+    struct rtc_level *pCurLevel = (struct rtc_level *)pArgs[0].pv_val;
+    i32p_t postcode = 0;
+
+    if (pCurLevel->notified) {
+        pCurLevel->notified = false;
+        EXIT_CRITICAL_SECTION();
+        return postcode;
+    }
+
+    thread_context_t *pCurThread = kernel_thread_runContextGet();
+    pCurLevel->pTask = &pCurThread->task;
+    postcode = schedule_exit_trigger(&pCurThread->task, pCurLevel, NULL, schedule_waitList(), OS_TIME_FOREVER_VAL);
+
+    EXIT_CRITICAL_SECTION();
+    return postcode;
+}
+
+/**
+ * @brief Add a run-to-completion task into the level, the task can't be moved to another level.
+ *
+ * @param pLevel The pointer of the run-to-completion level.
+ * @param pTask The pointer of the run-to-completion task.
+ *
+ * @return The result of the operation.
+ */
+i32p_t _impl_rtc_task_add(struct rtc_level *pLevel, struct rtc_task *pTask)
+{
+    if ((!pLevel) || (!pTask) || (!pTask->pHandlerFunc) || (!pTask->pEvents) || (!pTask->depth)) {
+        return PC_EOR;
+    }
+
+    arguments_t arguments[] = {
+        [0] = {.pv_val = (void *)pLevel},
+        [1] = {.pv_val = (void *)pTask},
+    };
+
+    return kernel_privilege_invoke((const void *)_rtc_task_add_privilege_routine, arguments);
+}
+
+/**
+ * @brief Post an event to the run-to-completion task, it can be called in the interrupt content.
+ *
+ * @param pTask The pointer of the run-to-completion task.
+ * @param event The event value.
+ *
+ * @return The result of the operation.
+ */
+i32p_t _impl_rtc_post(struct rtc_task *pTask, u32_t event)
+{
+    if ((!pTask) || (!pTask->pEvents) || (!pTask->depth)) {
+        return PC_EOR;
+    }
+
+    arguments_t arguments[] = {
+        [0] = {.pv_val = (void *)pTask},
+        [1] = {.u32_val = (u32_t)event},
+    };
+
+    return kernel_privilege_invoke((const void *)_rtc_post_privilege_routine, arguments);
+}
+
+/**
+ * @brief Handle the posted events of the level tasks in the calling thread, it never returns.
+ *
+ * @param pLevel The pointer of the run-to-completion level.
+ *
+ * @return The result of the operation if the level can't be run.
+ */
+i32p_t _impl_rtc_level_run(struct rtc_level *pLevel)
+{
+    if (!pLevel) {
+        return PC_EOR;
+    }
+
+    if (!kernel_isInThreadMode()) {
+        return PC_EOR;
+    }
+
+    while (1) {
+        b_t handled = false;
+
+        /* One event of each task per pass, so a busy task doesn't starve the others of the level */
+        struct rtc_task *pCurTask = pLevel->pHead;
+        while (pCurTask) {
+            u32_t event = 0u;
+            arguments_t arguments[] = {
+                [0] = {.pv_val = (void *)pCurTask},
+                [1] = {.pv_val = (void *)&event},
+            };
+
+            PC_IF(kernel_privilege_invoke((const void *)_rtc_event_take_privilege_routine, arguments), PC_PASS)
+            {
+                pCurTask->pHandlerFunc(pCurTask->pArg, event);
+                handled = true;
+            }
+            pCurTask = pCurTask->pNext;
+        }
+
+        if (handled) {
+            continue;
+        }
+
+        arguments_t arguments[] = {
+            [0] = {.pv_val = (void *)pLevel},
+        };
+        kernel_privilege_invoke((const void *)_rtc_level_wait_privilege_routine, arguments);
+    }
+
+    // Unreachable.
+    return PC_EOR;
+}
@@ -0,0 +1,458 @@
+/**
+ * Copyright (c) Riven Zheng (zhengheiot@gmail.com).
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ **/
+#include "kernel.h"
+#include "timer.h"
+#include "postcode.h"
+#include "trace.h"
+#include "init.h"
+
+/**
+ * Local unique postcode.
+ */
+#define PC_EOR PC_IER(PC_OS_CMPT_RWLOCK_11)
+
+/**
+ * @brief Check if the rwlock unique id if is's invalid.
+ *
+ * @param id The provided unique id.
+ *
+ * @return The true is invalid, otherwise is valid.
+ */
+static b_t _rwlock_context_isInvalid(rwlock_context_t *pCurRwlock)
+{
+    u32_t start, end;
+    INIT_SECTION_FIRST(INIT_SECTION_OS_RWLOCK_LIST, start);
+    INIT_SECTION_LAST(INIT_SECTION_OS_RWLOCK_LIST, end);
+
+    return ((u32_t)pCurRwlock < start || (u32_t)pCurRwlock >= end) ? true : false;
+}
+
+/**
+ * @brief Check if the rwlock object if is's initialized.
+ *
+ * @param id The provided unique id.
+ *
+ * @return The true is initialized, otherwise is uninitialized.
+ */
+static b_t _rwlock_context_isInit(rwlock_context_t *pCurRwlock)
+{
+    return ((pCurRwlock) ? (((pCurRwlock->head.cs) ? (true) : (false))) : false);
+}
+
+/**
+ * @brief Check if the read lock can be taken, the waiting writer has the preference unless the reader has the higher priority.
+ *
+ * @param pCurRwlock The pointer of the rwlock.
+ * @param priority The priority of the reader.
+ *
+ * @return The true indicates the reader can take the lock.
+ */
+static b_t _rwlock_read_isAvailable(rwlock_context_t *pCurRwlock, i16_t priority)
+{
+    if (pCurRwlock->pWriteTask) {
+        return false;
+    }
+
+    struct schedule_task *pWriter = (struct schedule_task *)list_head(&pCurRwlock->w_list);
+    return ((!pWriter) || (priority < pWriter->prior)) ? (true) : (false);
+}
+
+/**
+ * @brief Hand the released lock off to the highest priority waiters.
+ *
+ * @param pCurRwlock The pointer of the rwlock.
+ */
+static void _rwlock_handoff(rwlock_context_t *pCurRwlock)
+{
+    if (pCurRwlock->pWriteTask) {
+        return;
+    }
+
+    struct schedule_task *pWriter = (struct schedule_task *)list_head(&pCurRwlock->w_list);
+    struct schedule_task *pReader = (struct schedule_task *)list_head(&pCurRwlock->r_list);
+
+    if ((pWriter) && ((!pReader) || (pWriter->prior <= pReader->prior))) {
+        if (pCurRwlock->readers) {
+            // The writer takes it after the current readers are drained.
+            return;
+        }
+
+        /* The writer take the ticket, its timeout can't override the result any more */
+        timeout_remove(&pWriter->expire, true);
+        schedule_entry_trigger(pWriter, 0u);
+        pCurRwlock->pWriteTask = pWriter;
+        return;
+    }
+
+    /* All readers above the highest priority writer are released together */
+    while ((pReader) && ((!pWriter) || (pReader->prior < pWriter->prior))) {
+        timeout_remove(&pReader->expire, true);
+        schedule_entry_trigger(pReader, 0u);
+        pCurRwlock->readers++;
+
+        pReader = (struct schedule_task *)list_head(&pCurRwlock->r_list);
+    }
+}
+
+/**
+ * @brief The writer timed out and left the w_list, the readers that it held back are released at once.
+ *
+ * @param pCtx The pointer of the rwlock.
+ */
+static void _rwlock_pend_timeout(void *pCtx)
+{
+    _rwlock_handoff((rwlock_context_t *)pCtx);
+}
+
+/**
+ * @brief It's sub-routine running at privilege mode.
+ *
+ * @param pArgs The function argument packages.
+ *
+ * @return The result of privilege routine.
+ */
+static u32_t _rwlock_init_privilege_routine(arguments_t *pArgs)
+{
+    ENTER_CRITICAL_SECTION();
+
+    const char_t *pName = (const char_t *)(pArgs[0].pch_val);
+
+    rwlock_context_t *pCurRwlock = (rwlock_context_t *)init_slot_take(INIT_SLOT_RWLOCK);
+    if (!pCurRwlock) {
+        EXIT_CRITICAL_SECTION();
+        return 0u;
+    }
+
+    os_memset((char_t *)pCurRwlock, 0x0u, sizeof(rwlock_context_t));
+    pCurRwlock->head.cs = CS_INITED;
+    pCurRwlock->head.pName = pName;
+
+    pCurRwlock->readers = 0u;
+    pCurRwlock->pWriteTask = NULL;
+
+    EXIT_CRITICAL_SECTION();
+    return (u32_t)pCurRwlock;
+}
+
+/**
+ * @brief It's sub-routine running at privilege mode.
+ *
+ * @param pArgs The function argument packages.
+ *
+ * @return The result of privilege routine.
+ */
+static i32p_t _rwlock_read_lock_privilege_routine(arguments_t *pArgs)
+{
+    ENTER_CRITICAL_SECTION();
+
+    rwlock_context_t *pCurRwlock = (rwlock_context_t *)pArgs[0].u32_val;
+    u32_t timeout_ms = (u32_t)pArgs[1].u32_val;
+    thread_context_t *pCurThread = NULL;
+    i32p_t postcode = 0;
+
+    pCurThread = kernel_thread_runContextGet();
+    if (pCurRwlock->pWriteTask == &pCurThread->task) {
+        // The write task reads it again, it's a self-deadlock.
+        EXIT_CRITICAL_SECTION();
+        return PC_EOR;
+    }
+
+    if (!_rwlock_read_isAvailable(pCurRwlock, pCurThread->task.prior)) {
+        postcode = schedule_exit_trigger(&pCurThread->task, pCurRwlock, NULL, &pCurRwlock->r_list, timeout_ms);
+        PC_IF(postcode, PC_PASS)
+        {
+            postcode = PC_OS_WAIT_UNAVAILABLE;
+        }
+
+        EXIT_CRITICAL_SECTION();
+        return postcode;
+    }
+    pCurRwlock->readers++;
+
+    EXIT_CRITICAL_SECTION();
+    return postcode;
+}
+
+/**
+ * @brief It's sub-routine running at privilege mode.
+ *
+ * @param pArgs The function argument packages.
+ *
+ * @return The result of privilege routine.
+ */
+static i32p_t _rwlock_write_lock_privilege_routine(arguments_t *pArgs)
+{
+    ENTER_CRITICAL_SECTION();
+
+    rwlock_context_t *pCurRwlock = (rwlock_context_t *)pArgs[0].u32_val;
+    u32_t timeout_ms = (u32_t)pArgs[1].u32_val;
+    thread_context_t *pCurThread = NULL;
+    i32p_t postcode = 0;
+
+    pCurThread = kernel_thread_runContextGet();
+    if (pCurRwlock->pWriteTask == &pCurThread->task) {
+        // The write task writes it again, it's a self-deadlock.
+        EXIT_CRITICAL_SECTION();
+        return PC_EOR;
+    }
+
+    if ((pCurRwlock->pWriteTask) || (pCurRwlock->readers)) {
+        postcode = schedule_exit_trigger(&pCurThread->task, pCurRwlock, NULL, &pCurRwlock->w_list, timeout_ms);
+        schedule_pend_timeout_set(&pCurThread->task, _rwlock_pend_timeout);
+        PC_IF(postcode, PC_PASS)
+        {
+            postcode = PC_OS_WAIT_UNAVAILABLE;
+        }
+
+        EXIT_CRITICAL_SECTION();
+        return postcode;
+    }
+    pCurRwlock->pWriteTask = &pCurThread->task;
+
+    EXIT_CRITICAL_SECTION();
+    return postcode;
+}
+
+/**
+ * @brief It's sub-routine running at privilege mode.
+ *
+ * @param pArgs The function argument packages.
+ *
+ * @return The result of privilege routine.
+ */
+static i32p_t _rwlock_read_unlock_privilege_routine(arguments_t *pArgs)
+{
+    ENTER_CRITICAL_SECTION();
+
+    rwlock_context_t *pCurRwlock = (rwlock_context_t *)pArgs[0].u32_val;
+
+    if (!pCurRwlock->readers) {
+        EXIT_CRITICAL_SECTION();
+        return PC_EOR;
+    }
+    pCurRwlock->readers--;
+
+    _rwlock_handoff(pCurRwlock);
+    i32p_t postcode = kernel_thread_schedule_request();
+
+    EXIT_CRITICAL_SECTION();
+    return postcode;
+}
+
+/**
+ * @brief It's sub-routine running at privilege mode.
+ *
+ * @param pArgs The function argument packages.
+ *
+ * @return The result of privilege routine.
+ */
+static i32p_t _rwlock_write_unlock_privilege_routine(arguments_t *pArgs)
+{
+    ENTER_CRITICAL_SECTION();
+
+    rwlock_context_t *pCurRwlock = (rwlock_context_t *)pArgs[0].u32_val;
+
+    if (pCurRwlock->pWriteTask != &kernel_thread_runContextGet()->task) {
+        EXIT_CRITICAL_SECTION();
+        return PC_EOR;
+    }
+    pCurRwlock->pWriteTask = NULL;
+
+    _rwlock_handoff(pCurRwlock);
+    i32p_t postcode = kernel_thread_schedule_request();
+
+    EXIT_CRITICAL_SECTION();
+    return postcode;
+}
+
+/**
+ * @brief Take the blocking result after the privilege call.
+ *
+ * @param postcode The result of privilege call.
+ *
+ * @return The result of the operation.
+ */
+static i32p_t _rwlock_lock_result_take(i32p_t postcode)
+{
+    ENTER_CRITICAL_SECTION();
+
+    if (postcode == PC_OS_WAIT_UNAVAILABLE) {
+        postcode = kernel_schedule_result_take();
+    }
+
+    PC_IF(postcode, PC_PASS_INFO)
+    {
+        if (postcode != PC_OS_WAIT_TIMEOUT) {
+            postcode = 0;
+        }
+    }
+
+    EXIT_CRITICAL_SECTION();
+    return postcode;
+}
+
+/**
+ * @brief Initialize a new reader-writer lock.
+ *
+ * @param pName The rwlock name.
+ *
+ * @return The rwlock unique id.
+ */
+u32_t _impl_rwlock_init(const char_t *pName)
+{
+    arguments_t arguments[] = {
+        [0] = {.pch_val = (const char_t *)pName},
+    };
+
+    return kernel_privilege_invoke((const void *)_rwlock_init_privilege_routine, arguments);
+}
+
+/**
+ * @brief Take the shared read lock, the uncontended lock runs without the privilege call.
+ *
+ * @param id The rwlock unique id.
+ * @param timeout_ms The read lock timeout setting.
+ *
+ * @return The result of the operation.
+ */
+i32p_t _impl_rwlock_read_lock(u32_t ctx, u32_t timeout_ms)
+{
+    rwlock_context_t *pCtx = (rwlock_context_t *)ctx;
+    if (_rwlock_context_isInvalid(pCtx)) {
+        return PC_EOR;
+    }
+
+    if (!_rwlock_context_isInit(pCtx)) {
+        return PC_EOR;
+    }
+
+    if (!timeout_ms) {
+        return PC_EOR;
+    }
+
+    if (!kernel_isInThreadMode()) {
+        return PC_EOR;
+    }
+
+    ENTER_CRITICAL_SECTION();
+    if ((!pCtx->pWriteTask) && (!pCtx->w_list.pHead)) {
+        /* The uncontended read fast path */
+        pCtx->readers++;
+        EXIT_CRITICAL_SECTION();
+        return 0;
+    }
+    EXIT_CRITICAL_SECTION();
+
+    arguments_t arguments[] = {
+        [0] = {.u32_val = (u32_t)ctx},
+        [1] = {.u32_val = (u32_t)timeout_ms},
+    };
+
+    i32p_t postcode = kernel_privilege_invoke((const void *)_rwlock_read_lock_privilege_routine, arguments);
+    return _rwlock_lock_result_take(postcode);
+}
+
+/**
+ * @brief Release the shared read lock, it runs without the privilege call when no waiter is affected.
+ *
+ * @param id The rwlock unique id.
+ *
+ * @return The result of the operation.
+ */
+i32p_t _impl_rwlock_read_unlock(u32_t ctx)
+{
+    rwlock_context_t *pCtx = (rwlock_context_t *)ctx;
+    if (_rwlock_context_isInvalid(pCtx)) {
+        return PC_EOR;
+    }
+
+    if (!_rwlock_context_isInit(pCtx)) {
+        return PC_EOR;
+    }
+
+    if (kernel_isInThreadMode()) {
+        ENTER_CRITICAL_SECTION();
+        if ((pCtx->readers > 1u) || ((pCtx->readers) && (!pCtx->w_list.pHead) && (!pCtx->r_list.pHead))) {
+            /* The uncontended read fast path */
+            pCtx->readers--;
+            EXIT_CRITICAL_SECTION();
+            return 0;
+        }
+        EXIT_CRITICAL_SECTION();
+    }
+
+    arguments_t arguments[] = {
+        [0] = {.u32_val = (u32_t)ctx},
+    };
+
+    return kernel_privilege_invoke((const void *)_rwlock_read_unlock_privilege_routine, arguments);
+}
+
+/**
+ * @brief Take the exclusive write lock.
+ *
+ * @param id The rwlock unique id.
+ * @param timeout_ms The write lock timeout setting.
+ *
+ * @return The result of the operation.
+ */
+i32p_t _impl_rwlock_write_lock(u32_t ctx, u32_t timeout_ms)
+{
+    rwlock_context_t *pCtx = (rwlock_context_t *)ctx;
+    if (_rwlock_context_isInvalid(pCtx)) {
+        return PC_EOR;
+    }
+
+    if (!_rwlock_context_isInit(pCtx)) {
+        return PC_EOR;
+    }
+
+    if (!timeout_ms) {
+        return PC_EOR;
+    }
+
+    if (!kernel_isInThreadMode()) {
+        return PC_EOR;
+    }
+
+    arguments_t arguments[] = {
+        [0] = {.u32_val = (u32_t)ctx},
+        [1] = {.u32_val = (u32_t)timeout_ms},
+    };
+
+    i32p_t postcode = kernel_privilege_invoke((const void *)_rwlock_write_lock_privilege_routine, arguments);
+    return _rwlock_lock_result_take(postcode);
+}
+
+/**
+ * @brief Release the exclusive write lock.
+ *
+ * @param id The rwlock unique id.
+ *
+ * @return The result of the operation.
+ */
+i32p_t _impl_rwlock_write_unlock(u32_t ctx)
+{
+    rwlock_context_t *pCtx = (rwlock_context_t *)ctx;
+    if (_rwlock_context_isInvalid(pCtx)) {
+        return PC_EOR;
+    }
+
+    if (!_rwlock_context_isInit(pCtx)) {
+        return PC_EOR;
+    }
+
+    if (!kernel_isInThreadMode()) {
+        return PC_EOR;
+    }
+
+    arguments_t arguments[] = {
+        [0] = {.u32_val = (u32_t)ctx},
+    };
+
+    return kernel_privilege_invoke((const void *)_rwlock_write_unlock_privilege_routine, arguments);
+}
@@ -43,21 +43,6 @@ static b_t _semaphore_context_isInit(semaphore_context_t *pCurSemaphore)
     return ((pCurSemaphore) ? (((pCurSemaphore->head.cs) ? (true) : (false))) : false);
 }
 
-/**
- * @brief The semaphore schedule routine execute the the pendsv context.
- *
- * @param id The unique id of the entry thread.
- */
-static void _semaphore_schedule(void *pTask)
-{
-    struct schedule_task *pCurTask = (struct schedule_task *)pTask;
-    timeout_remove(&pCurTask->expire, true);
-    semaphore_context_t *pCurSemaphore = (semaphore_context_t *)pCurTask->pPendCtx;
-    /* If the PC arrive, the semaphore will be available and can be acquired */
-    pCurSemaphore->remains--; // The semaphore has available count
-    pCurTask->exec.entry.result = 0;
-}
-
 /**
  * @brief It's sub-routine running at privilege mode.
  *
@@ -73,28 +58,20 @@ static u32_t _semaphore_init_privilege_routine(arguments_t *pArgs)
     u8_t limitCount = (u8_t)(pArgs[1].u8_val);
     const char_t *pName = (const char_t *)(pArgs[2].pch_val);
 
-    INIT_SECTION_FOREACH(INIT_SECTION_OS_SEMAPHORE_LIST, semaphore_context_t, pCurSemaphore)
-    {
-        if (_semaphore_context_isInvalid(pCurSemaphore)) {
-            break;
-        }
-
-        if (_semaphore_context_isInit(pCurSemaphore)) {
-            continue;
-        }
-
-        os_memset((char_t *)pCurSemaphore, 0x0u, sizeof(semaphore_context_t));
-        pCurSemaphore->head.cs = CS_INITED;
-        pCurSemaphore->head.pName = pName;
-        pCurSemaphore->remains = initialCount;
-        pCurSemaphore->limits = limitCount;
-
+    semaphore_context_t *pCurSemaphore = (semaphore_context_t *)init_slot_take(INIT_SLOT_SEMAPHORE);
+    if (!pCurSemaphore) {
         EXIT_CRITICAL_SECTION();
-        return (u32_t)pCurSemaphore;
+        return 0u;
     }
 
+    os_memset((char_t *)pCurSemaphore, 0x0u, sizeof(semaphore_context_t));
+    pCurSemaphore->head.cs = CS_INITED;
+    pCurSemaphore->head.pName = pName;
+    pCurSemaphore->remains = initialCount;
+    pCurSemaphore->limits = limitCount;
+
     EXIT_CRITICAL_SECTION();
-    return 0u;
+    return (u32_t)pCurSemaphore;
 }
 
 /**
@@ -110,13 +87,24 @@ static i32p_t _semaphore_take_privilege_routine(arguments_t *pArgs)
 
     semaphore_context_t *pCurSemaphore = (semaphore_context_t *)pArgs[0].u32_val;
     u32_t timeout_ms = (u32_t)pArgs[1].u32_val;
+    struct coroutine_context *pCurCo = (struct coroutine_context *)pArgs[2].pv_val;
     thread_context_t *pCurThread = NULL;
     i32p_t postcode = PC_OS_WAIT_AVAILABLE;
 
     pCurThread = kernel_thread_runContextGet();
     if (!pCurSemaphore->remains) {
+        if (timeout_ms == OS_TIME_NOWAIT_VAL) {
+            /* The caller polls it, it's not an error */
+            if (pCurCo) {
+                coroutine_object_subscribe(pCurCo, &pCurSemaphore->pCoGroup);
+            }
+            EXIT_CRITICAL_SECTION();
+            return PC_OS_WAIT_TIMEOUT;
+        }
+
         /* No availabe count */
-        postcode = schedule_exit_trigger(&pCurThread->task, pCurSemaphore, NULL, &pCurSemaphore->q_list, timeout_ms, true);
+        postcode = schedule_exit_trigger(&pCurThread->task, pCurSemaphore, NULL, &pCurSemaphore->q_list, timeout_ms);
+        trace_contention_block(&pCurSemaphore->contention, &pCurSemaphore->q_list);
         PC_IF(postcode, PC_PASS)
         {
             postcode = PC_OS_WAIT_UNAVAILABLE;
@@ -128,6 +116,8 @@ static i32p_t _semaphore_take_privilege_routine(arguments_t *pArgs)
 
     /* The semaphore has available count */
     pCurSemaphore->remains--;
+    trace_contention_acquire(&pCurSemaphore->contention, NULL);
+    trace_contention_depth(&pCurSemaphore->contention, (u16_t)(pCurSemaphore->limits - pCurSemaphore->remains));
 
     EXIT_CRITICAL_SECTION();
     return postcode;
@@ -148,11 +138,15 @@ static i32p_t _semaphore_give_privilege_routine(arguments_t *pArgs)
     i32p_t postcode = 0;
 
     if (pCurSemaphore->remains < pCurSemaphore->limits) {
-        pCurSemaphore->remains++;
-
         struct schedule_task *pCurTask = (struct schedule_task *)list_head(&pCurSemaphore->q_list);
         if (pCurTask) {
-            postcode = schedule_entry_trigger(pCurTask, _semaphore_schedule, 0u);
+            /* Hand the count to the waiter directly, its timeout can't override the result any more */
+            timeout_remove(&pCurTask->expire, true);
+            postcode = schedule_entry_trigger(pCurTask, 0u);
+            trace_contention_acquire(&pCurSemaphore->contention, pCurTask);
+        } else {
+            pCurSemaphore->remains++;
+            coroutine_object_post(&pCurSemaphore->pCoGroup);
         }
     }
 
@@ -174,18 +168,8 @@ static i32p_t _semaphore_flush_privilege_routine(arguments_t *pArgs)
     semaphore_context_t *pCurSemaphore = (semaphore_context_t *)pArgs[0].u32_val;
     i32p_t postcode = 0;
 
-    list_iterator_t it = {0u};
-    list_t *pQList = (list_t *)&pCurSemaphore->q_list;
-    list_iterator_init(&it, pQList);
-    struct schedule_task *pCurTask = (struct schedule_task *)list_iterator_next(&it);
-    while (pCurTask) {
-        pCurSemaphore->remains++;
-        postcode = schedule_entry_trigger(pCurTask, _semaphore_schedule, 0u);
-        if (PC_IER(postcode)) {
-            break;
-        }
-        pCurTask = (struct schedule_task *)list_iterator_next(&it);
-    }
+    /* Each waiter takes a count that's given and taken at once */
+    postcode = schedule_entry_all_trigger((list_t *)&pCurSemaphore->q_list, 0u);
 
     EXIT_CRITICAL_SECTION();
     return postcode;
@@ -220,13 +204,15 @@ u32_t _impl_semaphore_init(u8_t remainCount, u8_t limitCount, const char_t *pNam
 }
 
 /**
- * @brief Take the semaphore away with timeout option.
+ * @brief Check the semaphore context and invoke the semaphore take routine.
  *
  * @param ctx The semaphore unique id.
+ * @param timeout_ms The semaphore take timeout setting.
+ * @param pCo The pointer of the coroutine that polls it, or NULL.
  *
  * @return The result of the operation.
  */
-i32p_t _impl_semaphore_take(u32_t ctx, u32_t timeout_ms)
+static i32p_t _semaphore_take_invoke(u32_t ctx, u32_t timeout_ms, struct coroutine_context *pCo)
 {
     semaphore_context_t *pCtx = (semaphore_context_t *)ctx;
     if (_semaphore_context_isInvalid(pCtx)) {
@@ -237,10 +223,6 @@ i32p_t _impl_semaphore_take(u32_t ctx, u32_t timeout_ms)
         return PC_EOR;
     }
 
-    if (!timeout_ms) {
-        return PC_EOR;
-    }
-
     if (!kernel_isInThreadMode()) {
         return PC_EOR;
     }
@@ -248,6 +230,7 @@ i32p_t _impl_semaphore_take(u32_t ctx, u32_t timeout_ms)
     arguments_t arguments[] = {
         [0] = {.u32_val = (u32_t)ctx},
         [1] = {.u32_val = (u32_t)timeout_ms},
+        [2] = {.pv_val = (void *)pCo},
     };
 
     i32p_t postcode = kernel_privilege_invoke((const void *)_semaphore_take_privilege_routine, arguments);
@@ -269,6 +252,35 @@ i32p_t _impl_semaphore_take(u32_t ctx, u32_t timeout_ms)
     return postcode;
 }
 
+/**
+ * @brief Take the semaphore away with timeout option.
+ *
+ * @param ctx The semaphore unique id.
+ *
+ * @return The result of the operation.
+ */
+i32p_t _impl_semaphore_take(u32_t ctx, u32_t timeout_ms)
+{
+    return _semaphore_take_invoke(ctx, timeout_ms, NULL);
+}
+
+/**
+ * @brief Take the semaphore in the coroutine without waiting, the give wakes the coroutine group up when it's not available.
+ *
+ * @param ctx The semaphore unique id.
+ * @param pCo The pointer of the coroutine.
+ *
+ * @return The result of the operation.
+ */
+i32p_t _impl_semaphore_co_take(u32_t ctx, struct coroutine_context *pCo)
+{
+    if (!pCo) {
+        return PC_EOR;
+    }
+
+    return _semaphore_take_invoke(ctx, OS_TIME_NOWAIT_VAL, pCo);
+}
+
 /**
  * @brief Give the semaphore to release the avaliable count.
  *
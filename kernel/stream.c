@@ -0,0 +1,710 @@
+/**
+ * Copyright (c) Riven Zheng (zhengheiot@gmail.com).
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE file in the root directory of this source tree.
+ **/
+#include "kernel.h"
+#include "timer.h"
+#include "postcode.h"
+#include "trace.h"
+#include "init.h"
+
+/**
+ * Local unique postcode.
+ */
+#define PC_EOR                   PC_IER(PC_OS_CMPT_STREAM_13)
+#define _STREAM_MESSAGE_PREFIX   (sizeof(u16_t))
+#define _STREAM_MESSAGE_PADDING  (0xFFFFu)
+#define _STREAM_MESSAGE_MAXIMUM  (0xFFFEu)
+
+/**
+ * @brief Check if the stream unique id if is's invalid.
+ *
+ * @param id The provided unique id.
+ *
+ * @return The true is invalid, otherwise is valid.
+ */
+static b_t _stream_context_isInvalid(stream_context_t *pCurStream)
+{
+    u32_t start, end;
+    INIT_SECTION_FIRST(INIT_SECTION_OS_STREAM_LIST, start);
+    INIT_SECTION_LAST(INIT_SECTION_OS_STREAM_LIST, end);
+
+    return ((u32_t)pCurStream < start || (u32_t)pCurStream >= end) ? true : false;
+}
+
+/**
+ * @brief Check if the stream object if is's initialized.
+ *
+ * @param id The provided unique id.
+ *
+ * @return The true is initialized, otherwise is uninitialized.
+ */
+static b_t _stream_context_isInit(stream_context_t *pCurStream)
+{
+    return ((pCurStream) ? (((pCurStream->head.cs) ? (true) : (false))) : false);
+}
+
+/**
+ * @brief Copy the data into the ring, it takes two copies at most when it crosses the ring end.
+ *
+ * @param pCurStream The current stream context.
+ * @param pData The pointer of the data.
+ * @param len The data length.
+ */
+static void _stream_copy_in(stream_context_t *pCurStream, const u8_t *pData, u32_t len)
+{
+    u32_t position = (pCurStream->readPosition + pCurStream->cacheSize) % pCurStream->bufferSize;
+    u32_t first = pCurStream->bufferSize - position;
+    if (first > len) {
+        first = len;
+    }
+
+    os_memcpy((char_t *)&pCurStream->pBufferAddress[position], (const char_t *)pData, first);
+    if (len > first) {
+        os_memcpy((char_t *)pCurStream->pBufferAddress, (const char_t *)&pData[first], len - first);
+    }
+    pCurStream->cacheSize += len;
+}
+
+/**
+ * @brief Copy the data out of the ring, it takes two copies at most when it crosses the ring end.
+ *
+ * @param pCurStream The current stream context.
+ * @param pData The pointer of the user buffer, the data is dropped when it's NULL.
+ * @param len The data length.
+ */
+static void _stream_copy_out(stream_context_t *pCurStream, u8_t *pData, u32_t len)
+{
+    u32_t position = pCurStream->readPosition;
+    u32_t first = pCurStream->bufferSize - position;
+    if (first > len) {
+        first = len;
+    }
+
+    if (pData) {
+        os_memcpy((char_t *)pData, (const char_t *)&pCurStream->pBufferAddress[position], first);
+        if (len > first) {
+            os_memcpy((char_t *)&pData[first], (const char_t *)pCurStream->pBufferAddress, len - first);
+        }
+    }
+
+    pCurStream->cacheSize -= len;
+    pCurStream->readPosition = (pCurStream->cacheSize) ? ((position + len) % pCurStream->bufferSize) : (0u);
+}
+
+/**
+ * @brief Get the tail bytes that the writer skips to keep the next message in one piece.
+ *
+ * @param pCurStream The current stream context.
+ * @param len The message length.
+ *
+ * @return The padding byte number.
+ */
+static u32_t _stream_message_padding(stream_context_t *pCurStream, u32_t len)
+{
+    if (!pCurStream->cacheSize) {
+        // The empty ring restarts from the beginning.
+        return 0u;
+    }
+
+    u32_t position = (pCurStream->readPosition + pCurStream->cacheSize) % pCurStream->bufferSize;
+    u32_t tail = pCurStream->bufferSize - position;
+    return (tail < (_STREAM_MESSAGE_PREFIX + len)) ? (tail) : (0u);
+}
+
+/**
+ * @brief Skip the padding bytes and get the length of the next message.
+ *
+ * @param pCurStream The current stream context.
+ *
+ * @return The length of the next message, the zero indicates the ring is empty.
+ */
+static u32_t _stream_message_head(stream_context_t *pCurStream)
+{
+    while (pCurStream->cacheSize) {
+        u32_t tail = pCurStream->bufferSize - pCurStream->readPosition;
+        u16_t len = _STREAM_MESSAGE_PADDING;
+
+        if (tail >= _STREAM_MESSAGE_PREFIX) {
+            os_memcpy((char_t *)&len, (const char_t *)&pCurStream->pBufferAddress[pCurStream->readPosition], _STREAM_MESSAGE_PREFIX);
+        }
+
+        if (len != _STREAM_MESSAGE_PADDING) {
+            return len;
+        }
+        _stream_copy_out(pCurStream, NULL, tail);
+    }
+
+    return 0u;
+}
+
+/**
+ * @brief Check if the data can be written into the ring.
+ *
+ * @param pCurStream The current stream context.
+ * @param len The data length.
+ *
+ * @return The true indicates the ring has enough free space.
+ */
+static b_t _stream_write_isAvailable(stream_context_t *pCurStream, u32_t len)
+{
+    u32_t need = len;
+    if (pCurStream->message) {
+        need += _STREAM_MESSAGE_PREFIX + _stream_message_padding(pCurStream, len);
+    }
+
+    return ((pCurStream->bufferSize - pCurStream->cacheSize) >= need) ? (true) : (false);
+}
+
+/**
+ * @brief Write the data or the message into the ring.
+ *
+ * @param pCurStream The current stream context.
+ * @param pData The pointer of the data.
+ * @param len The data length.
+ */
+static void _stream_write(stream_context_t *pCurStream, const u8_t *pData, u32_t len)
+{
+    if (pCurStream->message) {
+        u32_t padding = _stream_message_padding(pCurStream, len);
+        if (padding) {
+            u16_t marker = _STREAM_MESSAGE_PADDING;
+            if (padding >= _STREAM_MESSAGE_PREFIX) {
+                _stream_copy_in(pCurStream, (const u8_t *)&marker, _STREAM_MESSAGE_PREFIX);
+                padding -= _STREAM_MESSAGE_PREFIX;
+            }
+            pCurStream->cacheSize += padding;
+        }
+
+        u16_t prefix = (u16_t)len;
+        _stream_copy_in(pCurStream, (const u8_t *)&prefix, _STREAM_MESSAGE_PREFIX);
+    }
+    _stream_copy_in(pCurStream, pData, len);
+}
+
+/**
+ * @brief Get the byte number that the reader takes now.
+ *
+ * @param pCurStream The current stream context.
+ * @param size The size of the user buffer.
+ * @param level The minimum cached byte number of the stream.
+ *
+ * @return The readable byte number, the zero indicates it's unavailable, the negative value indicates the user buffer is too small.
+ */
+static i32_t _stream_read_available(stream_context_t *pCurStream, u32_t size, u32_t level)
+{
+    if (pCurStream->message) {
+        u32_t len = _stream_message_head(pCurStream);
+        if (!len) {
+            return 0;
+        }
+        return (len > size) ? (-1) : ((i32_t)len);
+    }
+
+    if (level > size) {
+        level = size;
+    }
+
+    if ((!pCurStream->cacheSize) || (pCurStream->cacheSize < level)) {
+        return 0;
+    }
+    return (i32_t)((pCurStream->cacheSize < size) ? (pCurStream->cacheSize) : (size));
+}
+
+/**
+ * @brief Read the data or the message from the ring.
+ *
+ * @param pCurStream The current stream context.
+ * @param pData The pointer of the user buffer.
+ * @param len The readable byte number.
+ */
+static void _stream_read(stream_context_t *pCurStream, u8_t *pData, u32_t len)
+{
+    if (pCurStream->message) {
+        _stream_copy_out(pCurStream, NULL, _STREAM_MESSAGE_PREFIX);
+    }
+    _stream_copy_out(pCurStream, pData, len);
+}
+
+/**
+ * @brief Serve the blocked readers and writers in the priority order until none can be served.
+ *
+ * @param pCurStream The current stream context.
+ */
+static void _stream_transfer(stream_context_t *pCurStream)
+{
+    b_t progress = true;
+
+    while (progress) {
+        progress = false;
+
+        struct schedule_task *pReader = (struct schedule_task *)list_head(&pCurStream->out_QList);
+        if (pReader) {
+            stream_sch_t *pSch = (stream_sch_t *)pReader->pPendData;
+            i32_t len = _stream_read_available(pCurStream, pSch->size, pCurStream->triggerLevel);
+            if (len) {
+                u32_t result = 0u;
+                if (len > 0) {
+                    _stream_read(pCurStream, (u8_t *)pSch->pUsrBuf, (u32_t)len);
+                    pSch->done = (u32_t)len;
+                } else {
+                    result = (u32_t)PC_EOR;
+                }
+
+                /* The reader take the data, its timeout can't override the result any more */
+                timeout_remove(&pReader->expire, true);
+                schedule_entry_trigger(pReader, result);
+                progress = true;
+            }
+        }
+
+        struct schedule_task *pWriter = (struct schedule_task *)list_head(&pCurStream->in_QList);
+        if (pWriter) {
+            stream_sch_t *pSch = (stream_sch_t *)pWriter->pPendData;
+            if (_stream_write_isAvailable(pCurStream, pSch->size)) {
+                _stream_write(pCurStream, pSch->pUsrBuf, pSch->size);
+                pSch->done = pSch->size;
+
+                /* The writer put the data, its timeout can't override the result any more */
+                timeout_remove(&pWriter->expire, true);
+                schedule_entry_trigger(pWriter, 0u);
+                progress = true;
+            }
+        }
+    }
+}
+
+/**
+ * @brief Take the blocking result after the privilege call.
+ *
+ * @param postcode The result of privilege call.
+ *
+ * @return The result of the operation.
+ */
+static i32p_t _stream_result_take(i32p_t postcode)
+{
+    ENTER_CRITICAL_SECTION();
+
+    if (postcode == PC_OS_WAIT_UNAVAILABLE) {
+        postcode = kernel_schedule_result_take();
+    }
+
+    PC_IF(postcode, PC_PASS_INFO)
+    {
+        if (postcode != PC_OS_WAIT_TIMEOUT) {
+            postcode = 0;
+        }
+    }
+
+    EXIT_CRITICAL_SECTION();
+    return postcode;
+}
+
+/**
+ * @brief It's sub-routine running at privilege mode.
+ *
+ * @param pArgs The function argument packages.
+ *
+ * @return The result of privilege routine.
+ */
+static u32_t _stream_init_privilege_routine(arguments_t *pArgs)
+{
+    ENTER_CRITICAL_SECTION();
+
+    u8_t *pBufferAddr = (u8_t *)(pArgs[0].ptr_val);
+    u32_t size = (u32_t)(pArgs[1].u32_val);
+    u32_t trigger = (u32_t)(pArgs[2].u32_val);
+    b_t message = (b_t)(pArgs[3].b_val);
+    const char_t *pName = (const char_t *)(pArgs[4].pch_val);
+
+    stream_context_t *pCurStream = (stream_context_t *)init_slot_take(INIT_SLOT_STREAM);
+    if (!pCurStream) {
+        EXIT_CRITICAL_SECTION();
+        return 0u;
+    }
+
+    os_memset((char_t *)pCurStream, 0x0u, sizeof(stream_context_t));
+    pCurStream->head.cs = CS_INITED;
+    pCurStream->head.pName = pName;
+
+    pCurStream->pBufferAddress = pBufferAddr;
+    pCurStream->bufferSize = size;
+    pCurStream->readPosition = 0u;
+    pCurStream->cacheSize = 0u;
+    pCurStream->triggerLevel = trigger;
+    pCurStream->message = message;
+
+    EXIT_CRITICAL_SECTION();
+    return (u32_t)pCurStream;
+}
+
+/**
+ * @brief It's sub-routine running at privilege mode.
+ *
+ * @param pArgs The function argument packages.
+ *
+ * @return The result of privilege routine.
+ */
+static i32p_t _stream_send_privilege_routine(arguments_t *pArgs)
+{
+    ENTER_CRITICAL_SECTION();
+
+    stream_context_t *pCurStream = (stream_context_t *)pArgs[0].u32_val;
+    stream_sch_t *pSch = (stream_sch_t *)pArgs[1].ptr_val;
+    u32_t timeout_ms = (u32_t)pArgs[2].u32_val;
+    i32p_t postcode = 0;
+
+    u32_t maximum = pCurStream->bufferSize;
+    if (pCurStream->message) {
+        maximum = (maximum > _STREAM_MESSAGE_PREFIX) ? (maximum - _STREAM_MESSAGE_PREFIX) : (0u);
+        maximum = (maximum > _STREAM_MESSAGE_MAXIMUM) ? (_STREAM_MESSAGE_MAXIMUM) : (maximum);
+    }
+
+    if (pSch->size > maximum) {
+        // The data can never be put into the ring.
+        EXIT_CRITICAL_SECTION();
+        return PC_EOR;
+    }
+
+    if ((!pCurStream->in_QList.pHead) && (_stream_write_isAvailable(pCurStream, pSch->size))) {
+        _stream_write(pCurStream, pSch->pUsrBuf, pSch->size);
+        pSch->done = pSch->size;
+
+        /* Try to wakeup the blocking readers */
+        _stream_transfer(pCurStream);
+
+        EXIT_CRITICAL_SECTION();
+        return postcode;
+    }
+
+    if (timeout_ms == OS_TIME_NOWAIT_VAL) {
+        /* The caller polls it, it's not an error */
+        EXIT_CRITICAL_SECTION();
+        return PC_OS_WAIT_TIMEOUT;
+    }
+
+    thread_context_t *pCurThread = kernel_thread_runContextGet();
+    postcode = schedule_exit_trigger(&pCurThread->task, pCurStream, pSch, &pCurStream->in_QList, timeout_ms);
+    PC_IF(postcode, PC_PASS)
+    {
+        postcode = PC_OS_WAIT_UNAVAILABLE;
+    }
+
+    EXIT_CRITICAL_SECTION();
+    return postcode;
+}
+
+/**
+ * @brief It's sub-routine running at privilege mode.
+ *
+ * @param pArgs The function argument packages.
+ *
+ * @return The result of privilege routine.
+ */
+static i32p_t _stream_receive_privilege_routine(arguments_t *pArgs)
+{
+    ENTER_CRITICAL_SECTION();
+
+    stream_context_t *pCurStream = (stream_context_t *)pArgs[0].u32_val;
+    stream_sch_t *pSch = (stream_sch_t *)pArgs[1].ptr_val;
+    u32_t timeout_ms = (u32_t)pArgs[2].u32_val;
+    i32p_t postcode = 0;
+
+    if (!pCurStream->out_QList.pHead) {
+        i32_t len = _stream_read_available(pCurStream, pSch->size, 0u);
+        if (len < 0) {
+            // The user buffer is too small for the next message.
+            EXIT_CRITICAL_SECTION();
+            return PC_EOR;
+        }
+
+        if (len) {
+            _stream_read(pCurStream, (u8_t *)pSch->pUsrBuf, (u32_t)len);
+            pSch->done = (u32_t)len;
+
+            /* Try to wakeup the blocking writers */
+            _stream_transfer(pCurStream);
+
+            EXIT_CRITICAL_SECTION();
+            return postcode;
+        }
+    }
+
+    if (timeout_ms == OS_TIME_NOWAIT_VAL) {
+        /* The caller polls it, it's not an error */
+        EXIT_CRITICAL_SECTION();
+        return PC_OS_WAIT_TIMEOUT;
+    }
+
+    thread_context_t *pCurThread = kernel_thread_runContextGet();
+    postcode = schedule_exit_trigger(&pCurThread->task, pCurStream, pSch, &pCurStream->out_QList, timeout_ms);
+    PC_IF(postcode, PC_PASS)
+    {
+        postcode = PC_OS_WAIT_UNAVAILABLE;
+    }
+
+    EXIT_CRITICAL_SECTION();
+    return postcode;
+}
+
+/**
+ * @brief It's sub-routine running at privilege mode.
+ *
+ * @param pArgs The function argument packages.
+ *
+ * @return The result of privilege routine.
+ */
+static i32p_t _stream_peek_privilege_routine(arguments_t *pArgs)
+{
+    ENTER_CRITICAL_SECTION();
+
+    stream_context_t *pCurStream = (stream_context_t *)pArgs[0].u32_val;
+    const u8_t **ppData = (const u8_t **)pArgs[1].ptr_val;
+    u32_t *pLength = (u32_t *)pArgs[2].ptr_val;
+
+    u32_t len = 0u;
+    u32_t position = pCurStream->readPosition;
+    if (pCurStream->message) {
+        len = _stream_message_head(pCurStream);
+        position = pCurStream->readPosition + _STREAM_MESSAGE_PREFIX;
+    } else {
+        // The contiguous part before the ring end.
+        len = pCurStream->bufferSize - position;
+        len = (len > pCurStream->cacheSize) ? (pCurStream->cacheSize) : (len);
+    }
+
+    if (!len) {
+        EXIT_CRITICAL_SECTION();
+        return PC_OS_WAIT_UNAVAILABLE;
+    }
+
+    *ppData = (const u8_t *)&pCurStream->pBufferAddress[position];
+    *pLength = len;
+
+    EXIT_CRITICAL_SECTION();
+    return 0;
+}
+
+/**
+ * @brief It's sub-routine running at privilege mode.
+ *
+ * @param pArgs The function argument packages.
+ *
+ * @return The result of privilege routine.
+ */
+static i32p_t _stream_consume_privilege_routine(arguments_t *pArgs)
+{
+    ENTER_CRITICAL_SECTION();
+
+    stream_context_t *pCurStream = (stream_context_t *)pArgs[0].u32_val;
+    u32_t len = (u32_t)pArgs[1].u32_val;
+
+    if (pCurStream->message) {
+        // The whole message is consumed at once.
+        len = _stream_message_head(pCurStream);
+        if (!len) {
+            EXIT_CRITICAL_SECTION();
+            return PC_EOR;
+        }
+        _stream_read(pCurStream, NULL, len);
+    } else {
+        if (len > pCurStream->cacheSize) {
+            EXIT_CRITICAL_SECTION();
+            return PC_EOR;
+        }
+        _stream_copy_out(pCurStream, NULL, len);
+    }
+
+    /* Try to wakeup the blocking writers */
+    _stream_transfer(pCurStream);
+
+    EXIT_CRITICAL_SECTION();
+    return 0;
+}
+
+/**
+ * @brief Initialize a new stream buffer or message buffer.
+ *
+ * @param pBufferAddr The pointer of the ring buffer.
+ * @param size The ring buffer size.
+ * @param trigger The cached byte number that wakes up the blocked reader, it's ignored by the message buffer.
+ * @param isMessage The message buffer keeps each write as a single message.
+ * @param pName The stream name.
+ *
+ * @return The stream unique id.
+ */
+u32_t _impl_stream_init(void *pBufferAddr, u32_t size, u32_t trigger, b_t isMessage, const char_t *pName)
+{
+    if (!pBufferAddr) {
+        return OS_INVALID_ID_VAL;
+    }
+
+    if (!size) {
+        return OS_INVALID_ID_VAL;
+    }
+
+    if (trigger > size) {
+        // The reader would never be woken up while the writers block on the full ring.
+        return OS_INVALID_ID_VAL;
+    }
+
+    arguments_t arguments[] = {
+        [0] = {.ptr_val = (void *)pBufferAddr},
+        [1] = {.u32_val = (u32_t)size},
+        [2] = {.u32_val = (u32_t)((trigger) ? (trigger) : (1u))},
+        [3] = {.b_val = (b_t)isMessage},
+        [4] = {.pch_val = (const char_t *)pName},
+    };
+
+    return kernel_privilege_invoke((const void *)_stream_init_privilege_routine, arguments);
+}
+
+/**
+ * @brief Send the data into the stream, or a single message into the message buffer.
+ *
+ * @param ctx The stream unique id.
+ * @param pData The pointer of the data.
+ * @param len The data length.
+ * @param timeout_ms The stream send timeout option.
+ *
+ * @return The result of the operation.
+ */
+i32p_t _impl_stream_send(u32_t ctx, const u8_t *pData, u32_t len, u32_t timeout_ms)
+{
+    stream_context_t *pCtx = (stream_context_t *)ctx;
+    if (_stream_context_isInvalid(pCtx)) {
+        return PC_EOR;
+    }
+
+    if (!_stream_context_isInit(pCtx)) {
+        return PC_EOR;
+    }
+
+    if ((!pData) || (!len)) {
+        return PC_EOR;
+    }
+
+    if (!kernel_isInThreadMode()) {
+        if (timeout_ms != OS_TIME_NOWAIT_VAL) {
+            return PC_EOR;
+        }
+    }
+
+    stream_sch_t sch = {.pUsrBuf = pData, .size = len, .done = 0u};
+    arguments_t arguments[] = {
+        [0] = {.u32_val = (u32_t)ctx},
+        [1] = {.ptr_val = (void *)&sch},
+        [2] = {.u32_val = (u32_t)timeout_ms},
+    };
+
+    i32p_t postcode = kernel_privilege_invoke((const void *)_stream_send_privilege_routine, arguments);
+    return _stream_result_take(postcode);
+}
+
+/**
+ * @brief Receive the data from the stream, or the next message from the message buffer.
+ *
+ * @param ctx The stream unique id.
+ * @param pBuffer The pointer of the user buffer.
+ * @param size The user buffer size.
+ * @param pLength The pointer of the received byte number.
+ * @param timeout_ms The stream receive timeout option.
+ *
+ * @return The result of the operation.
+ */
+i32p_t _impl_stream_receive(u32_t ctx, u8_t *pBuffer, u32_t size, u32_t *pLength, u32_t timeout_ms)
+{
+    stream_context_t *pCtx = (stream_context_t *)ctx;
+    if (_stream_context_isInvalid(pCtx)) {
+        return PC_EOR;
+    }
+
+    if (!_stream_context_isInit(pCtx)) {
+        return PC_EOR;
+    }
+
+    if ((!pBuffer) || (!size) || (!pLength)) {
+        return PC_EOR;
+    }
+
+    if (!kernel_isInThreadMode()) {
+        if (timeout_ms != OS_TIME_NOWAIT_VAL) {
+            return PC_EOR;
+        }
+    }
+
+    stream_sch_t sch = {.pUsrBuf = (const u8_t *)pBuffer, .size = size, .done = 0u};
+    arguments_t arguments[] = {
+        [0] = {.u32_val = (u32_t)ctx},
+        [1] = {.ptr_val = (void *)&sch},
+        [2] = {.u32_val = (u32_t)timeout_ms},
+    };
+
+    i32p_t postcode = kernel_privilege_invoke((const void *)_stream_receive_privilege_routine, arguments);
+    postcode = _stream_result_take(postcode);
+    *pLength = sch.done;
+
+    return postcode;
+}
+
+/**
+ * @brief Read the next data in place without the copy, it's released by the consume call.
+ *
+ * @param ctx The stream unique id.
+ * @param ppData The pointer of the data address in the ring.
+ * @param pLength The pointer of the contiguous byte number, or the next message length.
+ *
+ * @return The result of the operation.
+ */
+i32p_t _impl_stream_peek(u32_t ctx, const u8_t **ppData, u32_t *pLength)
+{
+    stream_context_t *pCtx = (stream_context_t *)ctx;
+    if (_stream_context_isInvalid(pCtx)) {
+        return PC_EOR;
+    }
+
+    if (!_stream_context_isInit(pCtx)) {
+        return PC_EOR;
+    }
+
+    if ((!ppData) || (!pLength)) {
+        return PC_EOR;
+    }
+
+    arguments_t arguments[] = {
+        [0] = {.u32_val = (u32_t)ctx},
+        [1] = {.ptr_val = (void *)ppData},
+        [2] = {.ptr_val = (void *)pLength},
+    };
+
+    return kernel_privilege_invoke((const void *)_stream_peek_privilege_routine, arguments);
+}
+
+/**
+ * @brief Release the data that was read in place.
+ *
+ * @param ctx The stream unique id.
+ * @param len The consumed byte number, the message buffer always consumes the whole next message.
+ *
+ * @return The result of the operation.
+ */
+i32p_t _impl_stream_consume(u32_t ctx, u32_t len)
+{
+    stream_context_t *pCtx = (stream_context_t *)ctx;
+    if (_stream_context_isInvalid(pCtx)) {
+        return PC_EOR;
+    }
+
+    if (!_stream_context_isInit(pCtx)) {
+        return PC_EOR;
+    }
+
+    arguments_t arguments[] = {
+        [0] = {.u32_val = (u32_t)ctx},
+        [1] = {.u32_val = (u32_t)len},
+    };
+
+    return kernel_privilege_invoke((const void *)_stream_consume_privilege_routine, arguments);
+}
@@ -111,26 +111,18 @@ static u32_t _publish_init_privilege_routine(arguments_t *pArgs)
 
     const char_t *pName = (const char_t *)(pArgs[0].pch_val);
 
-    INIT_SECTION_FOREACH(INIT_SECTION_OS_PUBLISH_LIST, publish_context_t, pCurPublish)
-    {
-        if (_publish_context_isInvalid(pCurPublish)) {
-            break;
-        }
-
-        if (_publish_context_isInit(pCurPublish)) {
-            continue;
-        }
-
-        os_memset((char_t *)pCurPublish, 0x0u, sizeof(publish_context_t));
-        pCurPublish->head.cs = CS_INITED;
-        pCurPublish->head.pName = pName;
-
+    publish_context_t *pCurPublish = (publish_context_t *)init_slot_take(INIT_SLOT_PUBLISH);
+    if (!pCurPublish) {
         EXIT_CRITICAL_SECTION();
-        return (u32_t)pCurPublish;
-    };
+        return 0u;
+    }
+
+    os_memset((char_t *)pCurPublish, 0x0u, sizeof(publish_context_t));
+    pCurPublish->head.cs = CS_INITED;
+    pCurPublish->head.pName = pName;
 
     EXIT_CRITICAL_SECTION();
-    return 0u;
+    return (u32_t)pCurPublish;
 }
 
 /**
@@ -196,34 +188,26 @@ static u32_t _subscribe_init_privilege_routine(arguments_t *pArgs)
     u16_t size = (u16_t)pArgs[1].u16_val;
     const char_t *pName = (const char_t *)(pArgs[2].pch_val);
 
-    INIT_SECTION_FOREACH(INIT_SECTION_OS_SUBSCRIBE_LIST, subscribe_context_t, pCurSubscribe)
-    {
-        if (_subscribe_context_isInvalid(pCurSubscribe)) {
-            break;
-        }
-
-        if (_subscribe_context_isInit(pCurSubscribe)) {
-            continue;
-        }
-
-        os_memset((char_t *)pCurSubscribe, 0x0u, sizeof(subscribe_context_t));
-        pCurSubscribe->head.cs = CS_INITED;
-        pCurSubscribe->head.pName = pName;
+    subscribe_context_t *pCurSubscribe = (subscribe_context_t *)init_slot_take(INIT_SLOT_SUBSCRIBE);
+    if (!pCurSubscribe) {
+        EXIT_CRITICAL_SECTION();
+        return 0u;
+    }
 
-        pCurSubscribe->pPublisher = NULL;
-        pCurSubscribe->accepted = 0u;
+    os_memset((char_t *)pCurSubscribe, 0x0u, sizeof(subscribe_context_t));
+    pCurSubscribe->head.cs = CS_INITED;
+    pCurSubscribe->head.pName = pName;
 
-        pCurSubscribe->notify.pData = pData;
-        pCurSubscribe->notify.len = size;
-        pCurSubscribe->notify.muted = false;
-        pCurSubscribe->notify.fn = subscribe_notification;
+    pCurSubscribe->pPublisher = NULL;
+    pCurSubscribe->accepted = 0u;
 
-        EXIT_CRITICAL_SECTION();
-        return (u32_t)pCurSubscribe;
-    };
+    pCurSubscribe->notify.pData = pData;
+    pCurSubscribe->notify.len = size;
+    pCurSubscribe->notify.muted = false;
+    pCurSubscribe->notify.fn = subscribe_notification;
 
     EXIT_CRITICAL_SECTION();
-    return 0u;
+    return (u32_t)pCurSubscribe;
 }
 
 /**
@@ -60,35 +60,31 @@ static u32_t _thread_init_privilege_routine(arguments_t *pArgs)
     i16_t priority = (i16_t)pArgs[3].u16_val;
     const char_t *pName = (const char_t *)pArgs[4].pch_val;
 
-    INIT_SECTION_FOREACH(INIT_SECTION_OS_THREAD_LIST, thread_context_t, pCurThread)
-    {
-        if (_thread_context_isInvalid(pCurThread)) {
-            break;
-        }
-
-        if (_thread_context_isInit(pCurThread)) {
-            continue;
-        }
-
-        os_memset((char_t *)pCurThread, 0x0u, sizeof(thread_context_t));
-        pCurThread->head.cs = CS_INITED;
-        pCurThread->head.pName = pName;
+    thread_context_t *pCurThread = (thread_context_t *)init_slot_take(INIT_SLOT_THREAD);
+    if (!pCurThread) {
+        EXIT_CRITICAL_SECTION();
+        return 0u;
+    }
 
-        pCurThread->pEntryFunc = pEntryFun;
-        pCurThread->pStackAddr = pAddress;
-        pCurThread->stackSize = size;
+    os_memset((char_t *)pCurThread, 0x0u, sizeof(thread_context_t));
+    pCurThread->head.cs = CS_INITED;
+    pCurThread->head.pName = pName;
 
-        pCurThread->task.prior = priority;
-        pCurThread->task.psp = (u32_t)kernel_stack_frame_init(pEntryFun, pAddress, size);
-        timeout_init(&pCurThread->task.expire, schedule_callback_fromTimeOut);
-        schedule_setPend(&pCurThread->task);
+    pCurThread->pEntryFunc = pEntryFun;
+    pCurThread->pStackAddr = pAddress;
+    pCurThread->stackSize = size;
 
-        EXIT_CRITICAL_SECTION();
-        return (u32_t)pCurThread;
-    }
+    pCurThread->task.prior = priority;
+    pCurThread->task.base_prior = priority;
+    pCurThread->task.psp = (u32_t)kernel_stack_frame_init(pEntryFun, pAddress, size);
+    timeout_init(&pCurThread->task.expire, schedule_callback_fromTimeOut);
+#if (THREAD_BUDGET_ENABLED)
+    timeout_init(&pCurThread->task.budget.expire, schedule_callback_fromBudget);
+#endif
+    schedule_setPend(&pCurThread->task);
 
     EXIT_CRITICAL_SECTION();
-    return 0u;
+    return (u32_t)pCurThread;
 }
 /**
  * @brief It's sub-routine running at privilege mode.
@@ -107,7 +103,7 @@ static i32p_t _thread_resume_privilege_routine(arguments_t *pArgs)
         EXIT_CRITICAL_SECTION();
         return postcode;
     }
-    postcode = schedule_entry_trigger(&pCurThread->task, NULL, 0u);
+    postcode = schedule_entry_trigger(&pCurThread->task, 0u);
 
     EXIT_CRITICAL_SECTION();
     return postcode;
@@ -130,7 +126,7 @@ static i32p_t _thread_suspend_privilege_routine(arguments_t *pArgs)
         EXIT_CRITICAL_SECTION();
         return postcode;
     }
-    postcode = schedule_exit_trigger(&pCurThread->task, NULL, NULL, schedule_waitList(), OS_TIME_FOREVER_VAL, false);
+    postcode = schedule_exit_trigger(&pCurThread->task, NULL, NULL, schedule_waitList(), OS_TIME_FOREVER_VAL);
 
     EXIT_CRITICAL_SECTION();
     return postcode;
@@ -155,7 +151,7 @@ static i32p_t _thread_yield_privilege_routine(arguments_t *pArgs)
         EXIT_CRITICAL_SECTION();
         return postcode;
     }
-    postcode = schedule_exit_trigger(&pCurThread->task, NULL, NULL, schedule_waitList(), OS_TIME_FOREVER_VAL, false);
+    postcode = schedule_exit_trigger(&pCurThread->task, NULL, NULL, schedule_waitList(), OS_TIME_FOREVER_VAL);
 
     EXIT_CRITICAL_SECTION();
     return postcode;
@@ -183,7 +179,7 @@ static i32p_t _thread_delete_privilege_routine(arguments_t *pArgs)
         EXIT_CRITICAL_SECTION();
         return postcode;
     }
-    postcode = schedule_exit_trigger(&pCurThread->task, NULL, NULL, NULL, OS_TIME_FOREVER_VAL, true);
+    postcode = schedule_exit_trigger(&pCurThread->task, NULL, NULL, NULL, OS_TIME_FOREVER_VAL);
     EXIT_CRITICAL_SECTION();
     return postcode;
 }
@@ -203,11 +199,112 @@ static i32p_t _thread_sleep_privilege_routine(arguments_t *pArgs)
     i32p_t postcode = PC_EOR;
 
     pCurThread = kernel_thread_runContextGet();
-    postcode = schedule_exit_trigger(&pCurThread->task, NULL, NULL, schedule_waitList(), timeout_ms, true);
+    postcode = schedule_exit_trigger(&pCurThread->task, NULL, NULL, schedule_waitList(), timeout_ms);
+
+    EXIT_CRITICAL_SECTION();
+    return postcode;
+}
+
+#if (THREAD_DEADLINE_ENABLED)
+/**
+ * @brief It's sub-routine running at privilege mode.
+ *
+ * @param pArgs The function argument packages.
+ *
+ * @return The result of privilege routine.
+ */
+static i32p_t _thread_deadline_set_privilege_routine(arguments_t *pArgs)
+{
+    ENTER_CRITICAL_SECTION();
+    thread_context_t *pCurThread = (thread_context_t *)pArgs[0].u32_val;
+    u32_t period_ms = (u32_t)pArgs[1].u32_val;
+    u32_t deadline_ms = (u32_t)pArgs[2].u32_val;
+    struct schedule_edf *pEdf = &pCurThread->task.edf;
+    u32_t now_ms = timer_total_system_ms_get();
+
+    pEdf->enabled = (period_ms) ? (true) : (false);
+    pEdf->period_ms = period_ms;
+    pEdf->deadline_ms = deadline_ms;
+    pEdf->release_ms = now_ms;
+    pEdf->abs_deadline_ms = now_ms + deadline_ms;
+    pEdf->jobs = 0u;
+    pEdf->misses = 0u;
+
+    /* Reorder the thread in the list where it stays by the new deadline */
+    schedule_priority_update(&pCurThread->task, pCurThread->task.prior);
+    i32p_t postcode = kernel_thread_schedule_request();
+
+    EXIT_CRITICAL_SECTION();
+    return postcode;
+}
+
+/**
+ * @brief It's sub-routine running at privilege mode.
+ *
+ * @param pArgs The function argument packages.
+ *
+ * @return The result of privilege routine.
+ */
+static i32p_t _thread_deadline_wait_privilege_routine(arguments_t *pArgs)
+{
+    ENTER_CRITICAL_SECTION();
+    UNUSED_MSG(pArgs);
+    thread_context_t *pCurThread = kernel_thread_runContextGet();
+    struct schedule_edf *pEdf = &pCurThread->task.edf;
+    u32_t now_ms = timer_total_system_ms_get();
+    i32p_t postcode = 0;
+
+    if (!pEdf->enabled) {
+        EXIT_CRITICAL_SECTION();
+        return PC_EOR;
+    }
+
+    /* The current job is completed */
+    pEdf->jobs++;
+    if ((i32_t)(now_ms - pEdf->abs_deadline_ms) > 0) {
+        pEdf->misses++;
+    }
+
+    pEdf->release_ms += pEdf->period_ms;
+    pEdf->abs_deadline_ms = pEdf->release_ms + pEdf->deadline_ms;
+
+    i32_t delay_ms = (i32_t)(pEdf->release_ms - now_ms);
+    if (delay_ms > 0) {
+        postcode = schedule_exit_trigger(&pCurThread->task, NULL, NULL, schedule_waitList(), (u32_t)delay_ms);
+    } else {
+        /* The job overruns its period, the next job is released at once */
+        schedule_priority_update(&pCurThread->task, pCurThread->task.prior);
+        postcode = kernel_thread_schedule_request();
+    }
+
+    EXIT_CRITICAL_SECTION();
+    return postcode;
+}
+#endif
+
+#if (THREAD_BUDGET_ENABLED)
+/**
+ * @brief It's sub-routine running at privilege mode.
+ *
+ * @param pArgs The function argument packages.
+ *
+ * @return The result of privilege routine.
+ */
+static i32p_t _thread_budget_set_privilege_routine(arguments_t *pArgs)
+{
+    ENTER_CRITICAL_SECTION();
+    thread_context_t *pCurThread = (thread_context_t *)pArgs[0].u32_val;
+    u32_t budget_us = (u32_t)pArgs[1].u32_val;
+    u32_t period_ms = (u32_t)pArgs[2].u32_val;
+
+    /* The running thread is charged from the schedule request */
+    schedule_budget_set(&pCurThread->task, budget_us, period_ms);
+    i32p_t postcode = kernel_thread_schedule_request();
 
     EXIT_CRITICAL_SECTION();
     return postcode;
 }
+#endif
 
 /**
  * @brief Get the thread name based on provided unique id.
@@ -236,6 +333,9 @@ void _impl_thread_static_init(thread_context_t *pCurThread)
 
     pCurThread->task.psp = (u32_t)kernel_stack_frame_init(pCurThread->pEntryFunc, pCurThread->pStackAddr, pCurThread->stackSize);
     timeout_init(&pCurThread->task.expire, schedule_callback_fromTimeOut);
+#if (THREAD_BUDGET_ENABLED)
+    timeout_init(&pCurThread->task.budget.expire, schedule_callback_fromBudget);
+#endif
     schedule_setPend(&pCurThread->task);
 
     EXIT_CRITICAL_SECTION();
@@ -396,3 +496,105 @@ i32p_t _impl_thread_sleep(u32_t timeout_ms)
 
     return kernel_privilege_invoke((const void *)_thread_sleep_privilege_routine, arguments);
 }
+
+/**
+ * @brief Put the thread into the earliest deadline first class, or back to the fixed priority class.
+ *
+ * @param ctx The thread unique id.
+ * @param period_ms The job release period, the value 0 puts the thread back to the fixed priority class.
+ * @param deadline_ms The relative deadline of each job, the value 0 takes the period.
+ *
+ * @return The result of the operation.
+ */
+i32p_t _impl_thread_deadline_set(u32_t ctx, u32_t period_ms, u32_t deadline_ms)
+{
+#if (THREAD_DEADLINE_ENABLED)
+    thread_context_t *pCtx = (thread_context_t *)ctx;
+    if (_thread_context_isInvalid(pCtx)) {
+        return PC_EOR;
+    }
+
+    if (!_thread_context_isInit(pCtx)) {
+        return PC_EOR;
+    }
+
+    if (!deadline_ms) {
+        deadline_ms = period_ms;
+    }
+
+    if (deadline_ms > period_ms) {
+        return PC_EOR;
+    }
+
+    arguments_t arguments[] = {
+        [0] = {.u32_val = (u32_t)ctx},
+        [1] = {.u32_val = (u32_t)period_ms},
+        [2] = {.u32_val = (u32_t)deadline_ms},
+    };
+
+    return kernel_privilege_invoke((const void *)_thread_deadline_set_privilege_routine, arguments);
+#else
+    UNUSED_MSG(ctx);
+    UNUSED_MSG(period_ms);
+    UNUSED_MSG(deadline_ms);
+    return PC_EOR;
+#endif
+}
+
+/**
+ * @brief Complete the current job of the deadline thread and sleep until the next job is released.
+ *
+ * @return The result of the operation.
+ */
+i32p_t _impl_thread_deadline_wait(void)
+{
+#if (THREAD_DEADLINE_ENABLED)
+    if (!kernel_isInThreadMode()) {
+        return PC_EOR;
+    }
+
+    return kernel_privilege_invoke((const void *)_thread_deadline_wait_privilege_routine, NULL);
+#else
+    return PC_EOR;
+#endif
+}
+
+/**
+ * @brief Limit the thread execution time by a budget that's replenished on each period.
+ *
+ * @param ctx The thread unique id.
+ * @param budget_us The execution budget in each period, the value 0 removes the limitation.
+ * @param period_ms The replenishment period.
+ *
+ * @return The result of the operation.
+ */
+i32p_t _impl_thread_budget_set(u32_t ctx, u32_t budget_us, u32_t period_ms)
+{
+#if (THREAD_BUDGET_ENABLED)
+    thread_context_t *pCtx = (thread_context_t *)ctx;
+    if (_thread_context_isInvalid(pCtx)) {
+        return PC_EOR;
+    }
+
+    if (!_thread_context_isInit(pCtx)) {
+        return PC_EOR;
+    }
+
+    if ((budget_us) && ((!period_ms) || ((u64_t)budget_us > ((u64_t)period_ms * 1000u)))) {
+        return PC_EOR;
+    }
+
+    arguments_t arguments[] = {
+        [0] = {.u32_val = (u32_t)ctx},
+        [1] = {.u32_val = (u32_t)budget_us},
+        [2] = {.u32_val = (u32_t)period_ms},
+    };
+
+    return kernel_privilege_invoke((const void *)_thread_budget_set_privilege_routine, arguments);
+#else
+    UNUSED_MSG(ctx);
+    UNUSED_MSG(budget_us);
+    UNUSED_MSG(period_ms);
+    return PC_EOR;
+#endif
+}
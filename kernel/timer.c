@@ -33,6 +33,11 @@ typedef struct {
     list_t tt_idle_list;
 
     list_t callback_list;
+
+    /* The recycled temporary timers, it's a dedicated one-shot pool */
+    list_t automatic_list;
+
+    struct timer_statistics statistics;
 } _timer_resource_t;
 
 /**
@@ -182,13 +187,42 @@ static void _timeout_remove_fromWaitList(linker_t *pLinker)
     EXIT_CRITICAL_SECTION();
 }
 
+/**
+ * @brief Calculate the latest clock interval that still meets the slack of every covered timeout.
+ *
+ * @param pCurExpired The pointer of the waiting list head.
+ *
+ * @return The value of the clock interval.
+ */
+static u64_t _timeout_coalesce_interval(struct expired_time *pCurExpired)
+{
+    u64_t deadline = 0u;
+    u64_t interval = 0u;
+    u64_t limit = (u64_t)(-1);
+
+    while (pCurExpired) {
+        deadline += pCurExpired->duration_us;
+        if (deadline > limit) {
+            break;
+        }
+        interval = deadline;
+
+        if ((deadline + pCurExpired->slack_us) < limit) {
+            limit = deadline + pCurExpired->slack_us;
+        }
+        pCurExpired = (struct expired_time *)pCurExpired->linker.node.pNext;
+    }
+
+    return interval;
+}
+
 static void _timeout_schedule(void)
 {
     ENTER_CRITICAL_SECTION();
 
     struct expired_time *pCurExpired = (struct expired_time *)g_timer_rsc.tt_wait_list.pHead;
     if (pCurExpired) {
-        clock_time_interval_set(pCurExpired->duration_us);
+        clock_time_interval_set(_timeout_coalesce_interval(pCurExpired));
     } else {
         clock_time_interval_set(OS_TIME_FOREVER_VAL);
     }
@@ -196,25 +230,41 @@ static void _timeout_schedule(void)
     EXIT_CRITICAL_SECTION();
 }
 
+/**
+ * @brief Give back the temporary timer to the dedicated one-shot pool without cleaning the whole context.
+ *
+ * @param pCurTimer The pointer of the temporary timer.
+ */
+static void _timer_automatic_recycle(timer_context_t *pCurTimer)
+{
+    ENTER_CRITICAL_SECTION();
+
+    pCurTimer->head.cs = 0u;
+    list_node_push((list_t *)&g_timer_rsc.automatic_list, &pCurTimer->head.free, LIST_HEAD);
+
+    EXIT_CRITICAL_SECTION();
+}
+
 void timer_callback_fromTimeOut(void *pNode)
 {
     timer_context_t *pCurTimer = (timer_context_t *)CONTAINEROF(pNode, timer_context_t, expire);
     struct expired_time *pExpired = (struct expired_time *)&pCurTimer->expire;
 
     if (pCurTimer->control == TIMER_CTRL_CYCLE_VAL) {
-        u64_t timeout_us = pCurTimer->timeout_ms * 1000u;
+        // The duration keeps the absolute deadline when it expired, the next deadline stays in the same phase.
+        u64_t timeout_us = (u64_t)pCurTimer->timeout_ms * 1000u;
         u64_t elapsed_us = g_timer_rsc.system_us - pExpired->duration_us;
+        u64_t missed = elapsed_us / timeout_us;
 
-        while (elapsed_us >= timeout_us) {
-            elapsed_us -= timeout_us;
-        }
-        pExpired->duration_us = timeout_us - elapsed_us;
+        pCurTimer->overrun += (u32_t)missed;
+        pExpired->duration_us = timeout_us - (elapsed_us - (missed * timeout_us));
         _timeout_transfer_toWaitList((linker_t *)&pExpired->linker);
     } else if (pCurTimer->control == TIMER_CTRL_ONCE_VAL) {
         _timeout_transfer_toIdleList((linker_t *)&pExpired->linker);
     } else if (pCurTimer->control == TIMER_CTRL_TEMPORARY_VAL) {
+        // The id is invalid from now on, the slot will be recycled after the callback was called.
         _timeout_transfer_toNoInitList((linker_t *)&pExpired->linker);
-        os_memset((u8_t *)pCurTimer, 0u, sizeof(timer_context_t));
+        pCurTimer->head.cs = 0u;
     }
 
     list_t *pCallback_list = (list_t *)&g_timer_rsc.callback_list;
@@ -264,28 +314,20 @@ static u32_t _timer_init_privilege_routine(arguments_t *pArgs)
     pTimer_callbackFunc_t pCallFun = (pTimer_callbackFunc_t)(pArgs[0].ptr_val);
     const char_t *pName = (const char_t *)pArgs[1].pch_val;
 
-    INIT_SECTION_FOREACH(INIT_SECTION_OS_TIMER_LIST, timer_context_t, pCurTimer)
-    {
-        if (_timer_context_isInvalid(pCurTimer)) {
-            break;
-        }
-
-        if (_timer_context_isInit(pCurTimer)) {
-            continue;
-        }
-
-        os_memset((char_t *)pCurTimer, 0x0u, sizeof(timer_context_t));
-        pCurTimer->head.cs = CS_INITED;
-        pCurTimer->head.pName = pName;
-        pCurTimer->call.pTimerCallEntry = pCallFun;
-        timeout_init(&pCurTimer->expire, timer_callback_fromTimeOut);
-
+    timer_context_t *pCurTimer = (timer_context_t *)init_slot_take(INIT_SLOT_TIMER);
+    if (!pCurTimer) {
         EXIT_CRITICAL_SECTION();
-        return (u32_t)pCurTimer;
+        return 0u;
     }
 
+    os_memset((char_t *)pCurTimer, 0x0u, sizeof(timer_context_t));
+    pCurTimer->head.cs = CS_INITED;
+    pCurTimer->head.pName = pName;
+    pCurTimer->call.pTimerCallEntry = pCallFun;
+    timeout_init(&pCurTimer->expire, timer_callback_fromTimeOut);
+
     EXIT_CRITICAL_SECTION();
-    return 0u;
+    return (u32_t)pCurTimer;
 }
 
 /**
@@ -301,30 +343,34 @@ static u32_t _timer_automatic_privilege_routine(arguments_t *pArgs)
 
     pTimer_callbackFunc_t pCallFun = (pTimer_callbackFunc_t)(pArgs[0].ptr_val);
     const char_t *pName = (const char_t *)pArgs[1].pch_val;
+    timer_context_t *pCurTimer = NULL;
 
-    INIT_SECTION_FOREACH(INIT_SECTION_OS_TIMER_LIST, timer_context_t, pCurTimer)
-    {
-        if (_timer_context_isInvalid(pCurTimer)) {
-            break;
-        }
-
-        if (_timer_context_isInit(pCurTimer)) {
-            continue;
+    list_node_t *pNode = list_node_pop((list_t *)&g_timer_rsc.automatic_list, LIST_HEAD);
+    if (pNode) {
+        pCurTimer = (timer_context_t *)CONTAINEROF(pNode, struct base_head, free);
+    } else {
+        pCurTimer = (timer_context_t *)init_slot_take(INIT_SLOT_TIMER);
+        if (!pCurTimer) {
+            EXIT_CRITICAL_SECTION();
+            return 0u;
         }
-
         os_memset((char_t *)pCurTimer, 0x0u, sizeof(timer_context_t));
-        pCurTimer->head.cs = CS_INITED;
-        pCurTimer->head.pName = pName;
-        pCurTimer->control = TIMER_CTRL_TEMPORARY_VAL;
-        pCurTimer->call.pTimerCallEntry = pCallFun;
-        timeout_init(&pCurTimer->expire, timer_callback_fromTimeOut);
-
-        EXIT_CRITICAL_SECTION();
-        return (u32_t)pCurTimer;
     }
 
+    // The recycled timer was removed from the timeout lists, only the used members need to be reset.
+    pCurTimer->head.cs = CS_INITED;
+    pCurTimer->head.pName = pName;
+    pCurTimer->control = TIMER_CTRL_TEMPORARY_VAL;
+    pCurTimer->timeout_ms = 0u;
+    pCurTimer->overrun = 0u;
+    pCurTimer->call.node.pNext = NULL;
+    pCurTimer->call.pTimerCallEntry = pCallFun;
+    pCurTimer->expire.duration_us = 0u;
+    pCurTimer->expire.slack_us = 0u;
+    pCurTimer->expire.fn = timer_callback_fromTimeOut;
+
     EXIT_CRITICAL_SECTION();
-    return 0u;
+    return (u32_t)pCurTimer;
 }
 
 /**
@@ -343,7 +389,10 @@ static u32_t _timer_start_privilege_routine(arguments_t *pArgs)
     u32_t timeout_ms = (u32_t)pArgs[2].u32_val;
 
     pCurTimer->timeout_ms = timeout_ms;
-    pCurTimer->control = ctrl;
+    pCurTimer->overrun = 0u;
+    if (pCurTimer->control != TIMER_CTRL_TEMPORARY_VAL) {
+        pCurTimer->control = ctrl;
+    }
     timeout_set(&pCurTimer->expire, timeout_ms, true);
 
     EXIT_CRITICAL_SECTION();
@@ -364,6 +413,36 @@ static u32_t _timer_stop_privilege_routine(arguments_t *pArgs)
     timer_context_t *pCurTimer = (timer_context_t *)pArgs[0].u32_val;
     timeout_remove(&pCurTimer->expire, true);
 
+    if (pCurTimer->control == TIMER_CTRL_TEMPORARY_VAL) {
+        // The temporary timer is released when it stops.
+        _timeout_transfer_toNoInitList((linker_t *)&pCurTimer->expire.linker);
+        list_node_delete((list_t *)&g_timer_rsc.callback_list, &pCurTimer->call.node);
+        _timer_automatic_recycle(pCurTimer);
+    }
+
+    EXIT_CRITICAL_SECTION();
+    return 0;
+}
+
+/**
+ * @brief It's sub-routine running at privilege mode.
+ *
+ * @param pArgs The function argument packages.
+ *
+ * @return The result of privilege routine.
+ */
+static u32_t _timer_slack_set_privilege_routine(arguments_t *pArgs)
+{
+    ENTER_CRITICAL_SECTION();
+
+    timer_context_t *pCurTimer = (timer_context_t *)pArgs[0].u32_val;
+    u32_t slack_ms = (u32_t)pArgs[1].u32_val;
+
+    pCurTimer->expire.slack_us = slack_ms * 1000u;
+    if (pCurTimer->expire.linker.pList == (list_t *)&g_timer_rsc.tt_wait_list) {
+        _timeout_schedule();
+    }
+
     EXIT_CRITICAL_SECTION();
     return 0;
 }
@@ -474,7 +553,9 @@ i32p_t _impl_timer_start(u32_t ctx, u8_t control, u32_t timeout_ms)
     }
 
     if ((control != TIMER_CTRL_ONCE_VAL) && (control != TIMER_CTRL_CYCLE_VAL)) {
-        return PC_EOR;
+        if ((control != TIMER_CTRL_TEMPORARY_VAL) || (pCtx->control != TIMER_CTRL_TEMPORARY_VAL)) {
+            return PC_EOR;
+        }
     }
 
     arguments_t arguments[] = {
@@ -511,6 +592,83 @@ i32p_t _impl_timer_stop(u32_t ctx)
     return kernel_privilege_invoke((const void *)_timer_stop_privilege_routine, arguments);
 }
 
+/**
+ * @brief Set the timer slack, the timer expiry can be delayed within it to share the clock interrupt with others.
+ *
+ * @param ctx The timer unique id.
+ * @param slack_ms The timer slack time.
+ *
+ * @return The result of timer slack operation.
+ */
+i32p_t _impl_timer_slack_set(u32_t ctx, u32_t slack_ms)
+{
+    timer_context_t *pCtx = (timer_context_t *)ctx;
+    if (_timer_context_isInvalid(pCtx)) {
+        return PC_EOR;
+    }
+
+    if (!_timer_context_isInit(pCtx)) {
+        return PC_EOR;
+    }
+
+    if (slack_ms > (U32_MAX / 1000u)) {
+        // The slack is kept in microseconds.
+        return PC_EOR;
+    }
+
+    arguments_t arguments[] = {
+        [0] = {.u32_val = (u32_t)ctx},
+        [1] = {.u32_val = (u32_t)slack_ms},
+    };
+
+    return kernel_privilege_invoke((const void *)_timer_slack_set_privilege_routine, arguments);
+}
+
+/**
+ * @brief Get the missed periods of the cycle timer since it started.
+ *
+ * @param ctx The timer unique id.
+ *
+ * @return The value of the overrun counter.
+ */
+u32_t _impl_timer_overrun_get(u32_t ctx)
+{
+    timer_context_t *pCtx = (timer_context_t *)ctx;
+    if (_timer_context_isInvalid(pCtx)) {
+        return 0u;
+    }
+
+    if (!_timer_context_isInit(pCtx)) {
+        return 0u;
+    }
+
+    ENTER_CRITICAL_SECTION();
+    u32_t overrun = pCtx->overrun;
+    EXIT_CRITICAL_SECTION();
+
+    return overrun;
+}
+
+/**
+ * @brief Take the timer statistics snapshot.
+ *
+ * @param pStatistics The pointer of the timer statistics.
+ *
+ * @return The result of the operation.
+ */
+i32p_t _impl_timer_statistics_get(struct timer_statistics *pStatistics)
+{
+    if (!pStatistics) {
+        return PC_EOR;
+    }
+
+    ENTER_CRITICAL_SECTION();
+    *pStatistics = g_timer_rsc.statistics;
+    EXIT_CRITICAL_SECTION();
+
+    return 0;
+}
+
 /**
  * @brief Check the timer to confirm if it's already scheduled in the waiting list.
  *
@@ -603,6 +761,11 @@ void timer_reamining_elapsed_handler(void)
             pCallFunEntry->pTimerCallEntry();
         }
 
+        timer_context_t *pCurTimer = (timer_context_t *)CONTAINEROF(pCallFunEntry, timer_context_t, call);
+        if ((pCurTimer->control == TIMER_CTRL_TEMPORARY_VAL) && (!pCurTimer->head.cs)) {
+            _timer_automatic_recycle(pCurTimer);
+        }
+
         ENTER_CRITICAL_SECTION();
         pCallFunEntry = (struct timer_callback *)list_node_pop(pListRunning, LIST_TAIL);
         EXIT_CRITICAL_SECTION();
@@ -630,7 +793,7 @@ void timeout_set(struct expired_time *pExpire, u32_t timeout_ms, b_t immediately
             _timeout_transfer_toIdleList((linker_t *)&pExpire->linker);
         }
     } else {
-        pExpire->duration_us = timeout_ms * 1000u;
+        pExpire->duration_us = (u64_t)timeout_ms * 1000u;
         _timeout_transfer_toWaitList((linker_t *)&pExpire->linker);
         need = true;
     }
@@ -669,21 +832,28 @@ void timeout_handler(u32_t elapsed_us)
     ENTER_CRITICAL_SECTION();
 
     struct expired_time *pCurExpired = NULL;
+    b_t expired = false;
+    list_t expired_list = LIST_NULL;
     g_timer_rsc.remaining_us = elapsed_us;
+    g_timer_rsc.statistics.interrupts++;
 
     list_iterator_t it = {0u};
     list_t *pListWaiting = (list_t *)&g_timer_rsc.tt_wait_list;
     list_iterator_init(&it, pListWaiting);
     while (list_iterator_next_condition(&it, (void *)&pCurExpired)) {
         if (g_timer_rsc.remaining_us >= pCurExpired->duration_us) {
+            if (expired && pCurExpired->duration_us) {
+                // The different deadline is served by the same clock interrupt.
+                g_timer_rsc.statistics.coalesced++;
+            }
+            expired = true;
             g_timer_rsc.remaining_us -= pCurExpired->duration_us;
             g_timer_rsc.system_us += pCurExpired->duration_us;
             pCurExpired->duration_us = 0u;
 
             if (pCurExpired->fn != timer_callback_fromTimeOut) {
-                pCurExpired->fn((void *)&pCurExpired->linker.node);
-
-                _timeout_transfer_toIdleList((linker_t *)&pCurExpired->linker);
+                // The callback is called after the wait list walk, it may set or remove the timeout nodes.
+                linker_list_transaction_common((linker_t *)&pCurExpired->linker, &expired_list, LIST_TAIL);
             } else {
                 pCurExpired->duration_us = g_timer_rsc.system_us;
                 _timeout_transfer_toPendList((linker_t *)&pCurExpired->linker);
@@ -696,6 +866,14 @@ void timeout_handler(u32_t elapsed_us)
     g_timer_rsc.system_us += g_timer_rsc.remaining_us;
     g_timer_rsc.remaining_us = 0u;
 
+    while (expired_list.pHead) {
+        pCurExpired = (struct expired_time *)expired_list.pHead;
+
+        /* It's idle before its callback, so the callback can set it again */
+        _timeout_transfer_toIdleList((linker_t *)&pCurExpired->linker);
+        pCurExpired->fn((void *)&pCurExpired->linker.node);
+    }
+
     b_t need = false;
     list_t *pListPending = (list_t *)&g_timer_rsc.tt_pend_list;
     list_iterator_init(&it, pListPending);
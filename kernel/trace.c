@@ -9,6 +9,7 @@
 #include "postcode.h"
 #include "linker.h"
 #include "init.h"
+#include "port.h"
 
 /**
  * Local trace postcode contrainer
@@ -71,6 +72,10 @@ void _impl_trace_thread(const pTrace_threadFunc_t fn)
 {
     INIT_SECTION_FOREACH(INIT_SECTION_OS_THREAD_LIST, thread_context_t, pCurThread)
     {
+        if (!pCurThread->head.cs) {
+            continue;
+        }
+
         if (fn) {
             fn((const thread_context_t *)pCurThread);
         }
@@ -84,8 +89,291 @@ void _impl_trace_analyze(const pTrace_analyzeFunc_t fn)
 {
     INIT_SECTION_FOREACH(INIT_SECTION_OS_THREAD_LIST, thread_context_t, pCurThread)
     {
+        if (!pCurThread->head.cs) {
+            continue;
+        }
+
         if (fn) {
             fn(pCurThread->task.exec.analyze);
         }
     }
 }
+
+/**
+ * @brief Take deadline thread snapshot information.
+ */
+void _impl_trace_deadline(const pTrace_deadlineFunc_t fn)
+{
+#if (THREAD_DEADLINE_ENABLED)
+    INIT_SECTION_FOREACH(INIT_SECTION_OS_THREAD_LIST, thread_context_t, pCurThread)
+    {
+        if (!pCurThread->head.cs) {
+            continue;
+        }
+
+        if (!pCurThread->task.edf.enabled) {
+            continue;
+        }
+
+        if (fn) {
+            fn((const thread_context_t *)pCurThread, (const struct schedule_edf *)&pCurThread->task.edf);
+        }
+    }
+#else
+    UNUSED_MSG(fn);
+#endif
+}
+
+/**
+ * @brief Take mutex contention snapshot information.
+ */
+void _impl_trace_mutex(const pTrace_contentionFunc_t fn)
+{
+#if (TRACE_CONTENTION_ENABLED)
+    INIT_SECTION_FOREACH(INIT_SECTION_OS_MUTEX_LIST, mutex_context_t, pCurMutex)
+    {
+        if (!pCurMutex->head.cs) {
+            continue;
+        }
+
+        if (fn) {
+            fn(pCurMutex->head.pName, (const struct contention_statistics *)&pCurMutex->contention);
+        }
+    }
+#else
+    UNUSED_MSG(fn);
+#endif
+}
+
+/**
+ * @brief Take semaphore contention snapshot information.
+ */
+void _impl_trace_semaphore(const pTrace_contentionFunc_t fn)
+{
+#if (TRACE_CONTENTION_ENABLED)
+    INIT_SECTION_FOREACH(INIT_SECTION_OS_SEMAPHORE_LIST, semaphore_context_t, pCurSemaphore)
+    {
+        if (!pCurSemaphore->head.cs) {
+            continue;
+        }
+
+        if (fn) {
+            fn(pCurSemaphore->head.pName, (const struct contention_statistics *)&pCurSemaphore->contention);
+        }
+    }
+#else
+    UNUSED_MSG(fn);
+#endif
+}
+
+/**
+ * @brief Take queue contention snapshot information.
+ */
+void _impl_trace_queue(const pTrace_contentionFunc_t fn)
+{
+#if (TRACE_CONTENTION_ENABLED)
+    INIT_SECTION_FOREACH(INIT_SECTION_OS_QUEUE_LIST, queue_context_t, pCurQueue)
+    {
+        if (!pCurQueue->head.cs) {
+            continue;
+        }
+
+        if (fn) {
+            fn(pCurQueue->head.pName, (const struct contention_statistics *)&pCurQueue->contention);
+        }
+    }
+#else
+    UNUSED_MSG(fn);
+#endif
+}
+
+#if (TRACE_CONTENTION_ENABLED)
+/**
+ * @brief Record an acquisition of the object, it's called in the kernel critical section.
+ *
+ * @param pStatistics The pointer of the object contention statistics.
+ * @param pWaiter The pointer of the woken waiter, the NULL indicates it's acquired without blocking.
+ */
+void trace_contention_acquire(struct contention_statistics *pStatistics, struct schedule_task *pWaiter)
+{
+    pStatistics->acquired++;
+    if (!pWaiter) {
+        return;
+    }
+
+    u32_t wait_us = pWaiter->exec.entry.wait_us;
+    pStatistics->total_wait_us += wait_us;
+    if (wait_us > pStatistics->max_wait_us) {
+        pStatistics->max_wait_us = wait_us;
+    }
+}
+
+/**
+ * @brief Record a contended acquisition that's blocked in the waiting list, it's called in the kernel critical section.
+ *
+ * @param pStatistics The pointer of the object contention statistics.
+ * @param pList The pointer of the waiting list.
+ */
+void trace_contention_block(struct contention_statistics *pStatistics, list_t *pList)
+{
+    pStatistics->contended++;
+
+    u32_t waiters = list_size(pList);
+    if (waiters > pStatistics->max_waiters) {
+        pStatistics->max_waiters = (u16_t)waiters;
+    }
+}
+
+/**
+ * @brief Record the used depth of the object, it's called in the kernel critical section.
+ *
+ * @param pStatistics The pointer of the object contention statistics.
+ * @param depth The current used depth.
+ */
+void trace_contention_depth(struct contention_statistics *pStatistics, u16_t depth)
+{
+    if (depth > pStatistics->max_depth) {
+        pStatistics->max_depth = depth;
+    }
+}
+#endif
+
+/**
+ * @brief Take thread wake-to-run latency snapshot information.
+ */
+void _impl_trace_thread_latency(const pTrace_latencyFunc_t fn)
+{
+#if (TRACE_SCHEDULE_LATENCY_ENABLED)
+    INIT_SECTION_FOREACH(INIT_SECTION_OS_THREAD_LIST, thread_context_t, pCurThread)
+    {
+        if (!pCurThread->head.cs) {
+            continue;
+        }
+
+        const struct call_latency *pLatency = &pCurThread->task.exec.latency;
+        trace_latency_t latency = {
+            .count = pLatency->count,
+            .min_us = pLatency->min_us,
+            .max_us = pLatency->max_us,
+            .p99_us = pLatency->max_us,
+        };
+
+        /* The p99 is the first bucket that the accumulation reaches 99 percent of the samples */
+        u32_t target = pLatency->count - (pLatency->count / 100u);
+        u32_t sum = 0u;
+        for (u32_t i = 0u; i < (TRACE_SCHEDULE_LATENCY_BUCKET_NUMBER - 1u); i++) {
+            sum += pLatency->histogram[i];
+            if (sum >= target) {
+                u32_t upper = (2u << i) - 1u;
+                latency.p99_us = (upper < pLatency->max_us) ? (upper) : (pLatency->max_us);
+                break;
+            }
+        }
+
+        if (fn) {
+            fn((const thread_context_t *)pCurThread, (const trace_latency_t *)&latency);
+        }
+    }
+#else
+    UNUSED_MSG(fn);
+#endif
+}
+
+/**
+ * @brief Clean the thread wake-to-run latency statistics.
+ */
+void _impl_trace_thread_latency_reset(void)
+{
+#if (TRACE_SCHEDULE_LATENCY_ENABLED)
+    ARCH_ENTER_CRITICAL_SECTION();
+
+    INIT_SECTION_FOREACH(INIT_SECTION_OS_THREAD_LIST, thread_context_t, pCurThread)
+    {
+        struct call_latency *pLatency = &pCurThread->task.exec.latency;
+        pLatency->count = 0u;
+        pLatency->min_us = 0u;
+        pLatency->max_us = 0u;
+        os_memset((char_t *)pLatency->histogram, 0x0u, sizeof(pLatency->histogram));
+    }
+
+    ARCH_EXIT_CRITICAL_SECTION();
+#endif
+}
+
+/**
+ * @brief Calculate the log2 histogram bucket of the value.
+ *
+ * @param value The sample value.
+ * @param number The bucket number, the last bucket takes all the larger value.
+ *
+ * @return The bucket index.
+ */
+u32_t trace_histogram_bucket(u32_t value, u32_t number)
+{
+    u32_t bucket = 0u;
+    while ((value >>= 1u) && (bucket < (number - 1u))) {
+        bucket++;
+    }
+    return bucket;
+}
+
+/**
+ * Local critical section profile list
+ */
+static critical_site_t *g_critical_site_list = NULL;
+
+/**
+ * @brief Record the masked cycles of the critical section call site, it's called before the interrupt is unmasked.
+ *
+ * @param pSite The pointer of the call site profile.
+ * @param start The cycle counter value when the critical section is entered.
+ */
+void trace_critical_section_record(critical_site_t *pSite, u32_t start)
+{
+    u32_t cycles = port_cycle_count_get() - start;
+
+    if (!pSite->linked) {
+        pSite->pNext = g_critical_site_list;
+        g_critical_site_list = pSite;
+        pSite->linked = true;
+    }
+
+    pSite->count++;
+    if (cycles > pSite->max_cycles) {
+        pSite->max_cycles = cycles;
+    }
+
+    pSite->histogram[trace_histogram_bucket(cycles, TRACE_CRITICAL_SECTION_BUCKET_NUMBER)]++;
+}
+
+/**
+ * @brief Take critical section profile snapshot information.
+ */
+void _impl_trace_critical_section(const pTrace_criticalFunc_t fn)
+{
+    critical_site_t *pSite = g_critical_site_list;
+    while (pSite) {
+        if (fn) {
+            fn((const critical_site_t *)pSite);
+        }
+        pSite = pSite->pNext;
+    }
+}
+
+/**
+ * @brief Clean the critical section profile statistics.
+ */
+void _impl_trace_critical_section_reset(void)
+{
+    ARCH_ENTER_CRITICAL_SECTION();
+
+    critical_site_t *pSite = g_critical_site_list;
+    while (pSite) {
+        pSite->count = 0u;
+        pSite->max_cycles = 0u;
+        os_memset((char_t *)pSite->histogram, 0x0u, sizeof(pSite->histogram));
+        pSite = pSite->pNext;
+    }
+
+    ARCH_EXIT_CRITICAL_SECTION();
+}
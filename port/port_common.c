@@ -8,6 +8,18 @@
 #include "clock_tick.h"
 #include "port.h"
 
+#if (FPU_LAZY_SWITCH_ENABLED)
+#if !(__FPU_PRESENT)
+#error "The lazy FPU context switch needs the core with the FPU"
+#endif
+#endif
+
+#if (TRACE_CRITICAL_SECTION_ENABLED)
+#if defined(ARCH_ARM_CORTEX_CM0) || defined(ARCH_ARM_CORTEX_CM0plus) || defined(ARCH_ARM_CORTEX_CM23)
+#error "The critical section profile needs the DWT cycle counter, which is not present in this core"
+#endif
+#endif
+
 /**
  * @brief ARM core systick interrupt handle function.
  */
@@ -24,6 +36,28 @@ void HardFault_Handler(void)
     while (1) {};
 }
 
+#if (FPU_LAZY_SWITCH_ENABLED)
+/**
+ * @brief ARM core usage fault interrupt handle function, the thread without the FPU access takes the FPU ownership here.
+ *
+ * @param exc_return The EXC_RETURN of the usage fault, the bit 3 is set when the fault is taken from the thread mode.
+ */
+void port_usageFault_inHandler_c(u32_t exc_return)
+{
+    if ((SCB->CFSR & SCB_CFSR_NOCP_Msk) && (exc_return & B(3))) {
+        SCB->CFSR = SCB_CFSR_NOCP_Msk; // Write one to clear, the faulting instruction runs again at the return
+        port_fpu_access_set(true);
+
+        extern void kernel_fpu_trap_handler(void);
+        kernel_fpu_trap_handler();
+        return;
+    }
+
+    /* The interrupt handler has no FPU ownership to take, the floating point instruction isn't allowed in it */
+    while (1) {};
+}
+#endif
+
 /**
  * @brief To check if it's in interrupt content.
  */
@@ -67,6 +101,55 @@ void port_interrupt_init(void)
     NVIC_SetPriority(PendSV_IRQn, 0xFFu); // Set PendSV to lowest possible priority
     NVIC_SetPriority(SVCall_IRQn, 0u); // Set SV to lowest possible priority
     NVIC_SetPriority(SysTick_IRQn, 0u);
+
+#if (TRACE_CRITICAL_SECTION_ENABLED)
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk; // Enable the DWT cycle counter for the critical section profile
+    DWT->CYCCNT = 0u;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+#endif
+
+#if (FPU_LAZY_SWITCH_ENABLED)
+    // The FPU context isn't stacked by the exceptions any more, so the PendSV never saves the S16 - S31. The FPU access is granted to
+    // its owner thread only, and the others trap into the UsageFault at the first floating point instruction. The lazy state
+    // preservation is kept for the context that's still marked as FPU active.
+    FPU->FPCCR &= ~FPU_FPCCR_ASPEN_Msk;
+    SCB->SHCSR |= SCB_SHCSR_USGFAULTENA_Msk;
+    port_fpu_access_set(false);
+#endif
+}
+
+/**
+ * @brief Grant or revoke the CP10 and CP11 access of the FPU.
+ *
+ * @param enable The true grants the full access.
+ */
+void port_fpu_access_set(b_t enable)
+{
+#if (FPU_LAZY_SWITCH_ENABLED)
+    if (enable) {
+        SCB->CPACR |= ((3UL << 20u) | (3UL << 22u));
+    } else {
+        SCB->CPACR &= ~((3UL << 20u) | (3UL << 22u));
+    }
+    __DSB();
+    __ISB();
+#else
+    UNUSED_MSG(enable);
+#endif
+}
+
+/**
+ * @brief Get the current core cycle counter.
+ *
+ * @return The value of the free running cycle counter.
+ */
+u32_t port_cycle_count_get(void)
+{
+#if (TRACE_CRITICAL_SECTION_ENABLED)
+    return DWT->CYCCNT;
+#else
+    return 0u;
+#endif
 }
 
 /**
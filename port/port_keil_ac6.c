@@ -113,6 +113,57 @@ void PendSV_Handler(void)
         );
 }
 
+#if ( FPU_ENABLED ) && ( FPU_LAZY_SWITCH_ENABLED )
+/**
+ * @brief ARM core usage fault interrupt handle function.
+ */
+void UsageFault_Handler(void)
+{
+    __asm volatile
+    (
+        "   .syntax unified                                 \n"
+        "   .extern port_usageFault_inHandler_c             \n"
+        "                                                   \n"
+        "   mov   r0, lr                                    \n" /* Set R0 = EXC_RETURN, the bit 3 indicates the fault is from thread mode */
+        "   b     port_usageFault_inHandler_c               \n" /* call port_usageFault_inHandler_c */
+        "                                                   \n"
+        "   .align 4                                        \n"
+    );
+}
+
+/**
+ * @brief Save the FPU context of its previous owner thread.
+ *
+ * @param pRegs The pointer of the {S0 - S31, FPSCR} save area.
+ */
+void port_fpu_context_save(u32_t *pRegs)
+{
+    __asm volatile
+    (
+        "   vstmia   %0!, {s0 - s31}                        \n" /* Save {S0 - S31} */
+        "   vmrs     r1, fpscr                              \n"
+        "   str      r1, [%0]                               \n" /* Save FPSCR */
+        : "+r" (pRegs) : : "r1", "memory"
+    );
+}
+
+/**
+ * @brief Restore the FPU context of its new owner thread.
+ *
+ * @param pRegs The pointer of the {S0 - S31, FPSCR} save area.
+ */
+void port_fpu_context_restore(const u32_t *pRegs)
+{
+    __asm volatile
+    (
+        "   vldmia   %0!, {s0 - s31}                        \n" /* Restore {S0 - S31} */
+        "   ldr      r1, [%0]                               \n"
+        "   vmsr     fpscr, r1                              \n" /* Restore FPSCR */
+        : "+r" (pRegs) : : "r1", "memory"
+    );
+}
+#endif
+
 /**
  * @brief ARM core trigger the first thread to run.
  */
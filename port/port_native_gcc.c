@@ -4,9 +4,34 @@
  * This source code is licensed under the MIT license found in the
  * LICENSE file in the root directory of this source tree.
  **/
+#include <time.h>
 #include "type_def.h"
 #include "arch.h"
 
+/**
+ * The host has no FPU access control, so the FPU is modelled in software and the lazy switch runs the same kernel path as on the core.
+ */
+typedef struct {
+    /* The FPU access is granted to the running thread */
+    b_t access;
+
+    /* The modelled {S0 - S31, FPSCR} */
+    u32_t regs[33];
+
+    /* The instructions that trapped without the access */
+    u32_t traps;
+
+    /* The context saves and restores done on the modelled FPU */
+    u32_t saves;
+
+    u32_t restores;
+} _port_fpu_model_t;
+
+/**
+ * Local host FPU model
+ */
+static _port_fpu_model_t g_port_fpu = {0};
+
 /**
  * @brief ARM core trigger the svc call interrupt.
  */
@@ -66,6 +91,87 @@ void port_interrupt_init(void)
     /* TODO */
 }
 
+/**
+ * @brief Get the current core cycle counter, the host has no core cycle counter so it counts in nanoseconds.
+ *
+ * @return The value of the free running counter.
+ */
+u32_t port_cycle_count_get(void)
+{
+    struct timespec ts = {0};
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return (u32_t)((u32_t)ts.tv_sec * 1000000000u + (u32_t)ts.tv_nsec);
+}
+
+/**
+ * @brief Grant or revoke the FPU access.
+ *
+ * @param enable The true grants the full access.
+ */
+void port_fpu_access_set(b_t enable)
+{
+    g_port_fpu.access = enable;
+}
+
+/**
+ * @brief Save the FPU context of its previous owner thread.
+ *
+ * @param pRegs The pointer of the save area.
+ */
+void port_fpu_context_save(u32_t *pRegs)
+{
+    for (u32_t i = 0u; i < DIMOF(g_port_fpu.regs); i++) {
+        pRegs[i] = g_port_fpu.regs[i];
+    }
+    g_port_fpu.saves++;
+}
+
+/**
+ * @brief Restore the FPU context of its new owner thread.
+ *
+ * @param pRegs The pointer of the save area.
+ */
+void port_fpu_context_restore(const u32_t *pRegs)
+{
+    for (u32_t i = 0u; i < DIMOF(g_port_fpu.regs); i++) {
+        g_port_fpu.regs[i] = pRegs[i];
+    }
+    g_port_fpu.restores++;
+}
+
+/**
+ * @brief Execute a floating point instruction on the modelled FPU, the thread without the access traps like the UsageFault on the core.
+ *
+ * @return The pointer of the modelled {S0 - S31, FPSCR} that the running thread owns.
+ */
+u32_t *port_fpu_use(void)
+{
+    if (!g_port_fpu.access) {
+        g_port_fpu.traps++;
+        g_port_fpu.access = true;
+
+        extern void kernel_fpu_trap_handler(void);
+        kernel_fpu_trap_handler();
+    }
+
+    return g_port_fpu.regs;
+}
+
+/**
+ * @brief Get the modelled FPU counters, the kernel statistics saves are expected to match the saves here.
+ *
+ * @param pTraps The pointer of the trap number.
+ * @param pSaves The pointer of the context save number.
+ * @param pRestores The pointer of the context restore number.
+ */
+void port_fpu_model_get(u32_t *pTraps, u32_t *pSaves, u32_t *pRestores)
+{
+    *pTraps = g_port_fpu.traps;
+    *pSaves = g_port_fpu.saves;
+    *pRestores = g_port_fpu.restores;
+}
+
 /**
  * @brief ARM core SVC interrupt handle function.
  */